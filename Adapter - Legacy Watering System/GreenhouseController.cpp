@@ -1,32 +1,33 @@
 #include "GreenhouseController.h"
 #include "../Composite - The Store layout/GreenhouseComponent.h"
+#include "../Core - Simulation Services/Logger.h"
 #include <iostream>
 
 GreenhouseController::GreenhouseController(ModernWateringSystem *system, GreenhouseComponent *greenhouseComp)
     : wateringSystem(system), greenhouse(greenhouseComp), currentSeason("spring")
 {
-    std::cout << "\n===========================================" << std::endl;
-    std::cout << "  GREENHOUSE CONTROLLER INITIALIZED" << std::endl;
-    std::cout << "===========================================" << std::endl;
+    LOG_INFO("===========================================");
+    LOG_INFO("  GREENHOUSE CONTROLLER INITIALIZED");
+    LOG_INFO("===========================================");
     wateringSystem->adjustForSeason(currentSeason);
 }
 
 GreenhouseController::~GreenhouseController()
 {
-    std::cout << "GreenhouseController: Shutting down..." << std::endl;
+    LOG_INFO("GreenhouseController: Shutting down...");
 }
 
 void GreenhouseController::performDailyMaintenance()
 {
-    std::cout << "\n===========================================" << std::endl;
-    std::cout << "  DAILY MAINTENANCE ROUTINE" << std::endl;
-    std::cout << "===========================================" << std::endl;
-    std::cout << "Season: " << currentSeason << std::endl;
+    LOG_INFO("===========================================");
+    LOG_INFO("  DAILY MAINTENANCE ROUTINE");
+    LOG_INFO("===========================================");
+    LOG_INFO("Season: " << currentSeason);
 
     // Greenhouse handles its own plant updates through composite structure
     if (greenhouse)
     {
-        std::cout << "Greenhouse: Performing plant updates..." << std::endl;
+        LOG_INFO("Greenhouse: Performing plant updates...");
         // greenhouse->performMaintenance(); // If this method exists in GreenhouseComponent
     }
 
@@ -36,17 +37,17 @@ void GreenhouseController::performDailyMaintenance()
 
 void GreenhouseController::waterGreenhouse()
 {
-    std::cout << "\nGreenhouseController: Initiating watering cycle..." << std::endl;
+    LOG_INFO("GreenhouseController: Initiating watering cycle...");
     wateringSystem->waterGreenhouse(greenhouse);
 }
 
 void GreenhouseController::changeSeason(const std::string &season)
 {
-    std::cout << "\n===========================================" << std::endl;
-    std::cout << "  SEASONAL CHANGE" << std::endl;
-    std::cout << "===========================================" << std::endl;
-    std::cout << "GreenhouseController: Changing season from "
-              << currentSeason << " to " << season << std::endl;
+    LOG_INFO("===========================================");
+    LOG_INFO("  SEASONAL CHANGE");
+    LOG_INFO("===========================================");
+    LOG_INFO("GreenhouseController: Changing season from "
+             << currentSeason << " to " << season);
 
     currentSeason = season;
     wateringSystem->adjustForSeason(season);
@@ -54,7 +55,7 @@ void GreenhouseController::changeSeason(const std::string &season)
     // Greenhouse handles updating its plants' seasons
     if (greenhouse)
     {
-        std::cout << "GreenhouseController: Notifying greenhouse of season change..." << std::endl;
+        LOG_INFO("GreenhouseController: Notifying greenhouse of season change...");
         // greenhouse->changeSeason(season); // If this method exists
     }
 }
@@ -1,48 +1,48 @@
 #include "LegacyIrrigationSystem.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 #include <iomanip>
 
 LegacyIrrigationSystem::LegacyIrrigationSystem()
     : waterPressure(5), systemMode("manual"), systemActive(true)
 {
-    std::cout << "[LEGACY SYSTEM] Irrigation System v1.2 initialized" << std::endl;
-    std::cout << "[LEGACY SYSTEM] Default pressure: 5, Mode: manual" << std::endl;
+    LOG_INFO("[LEGACY SYSTEM] Irrigation System v1.2 initialized");
+    LOG_INFO("[LEGACY SYSTEM] Default pressure: 5, Mode: manual");
 }
 
 LegacyIrrigationSystem::~LegacyIrrigationSystem()
 {
-    std::cout << "[LEGACY SYSTEM] Shutting down irrigation system" << std::endl;
+    LOG_INFO("[LEGACY SYSTEM] Shutting down irrigation system");
 }
 
 void LegacyIrrigationSystem::activateZone(int zoneId, int durationMinutes)
 {
     if (!systemActive)
     {
-        std::cout << "[LEGACY SYSTEM] ERROR: System is not active!" << std::endl;
+        LOG_ERROR("[LEGACY SYSTEM] ERROR: System is not active!");
         return;
     }
 
-    std::cout << "[LEGACY SYSTEM] >> ACTIVATING Zone " << zoneId << std::endl;
-    std::cout << "[LEGACY SYSTEM]    Duration: " << durationMinutes << " minutes" << std::endl;
-    std::cout << "[LEGACY SYSTEM]    Pressure: " << waterPressure << "/10" << std::endl;
-    std::cout << "[LEGACY SYSTEM]    Mode: " << systemMode << std::endl;
+    LOG_INFO("[LEGACY SYSTEM] >> ACTIVATING Zone " << zoneId);
+    LOG_INFO("[LEGACY SYSTEM]    Duration: " << durationMinutes << " minutes");
+    LOG_INFO("[LEGACY SYSTEM]    Pressure: " << waterPressure << "/10");
+    LOG_INFO("[LEGACY SYSTEM]    Mode: " << systemMode);
 }
 
 void LegacyIrrigationSystem::deactivateZone(int zoneId)
 {
-    std::cout << "[LEGACY SYSTEM] >> DEACTIVATING Zone " << zoneId << std::endl;
+    LOG_INFO("[LEGACY SYSTEM] >> DEACTIVATING Zone " << zoneId);
 }
 
 void LegacyIrrigationSystem::setPressure(int pressure)
 {
     if (pressure < 1 || pressure > 10)
     {
-        std::cout << "[LEGACY SYSTEM] ERROR: Pressure must be between 1-10" << std::endl;
+        LOG_ERROR("[LEGACY SYSTEM] ERROR: Pressure must be between 1-10");
         return;
     }
 
     waterPressure = pressure;
-    std::cout << "[LEGACY SYSTEM] Pressure adjusted to " << pressure << "/10" << std::endl;
+    LOG_INFO("[LEGACY SYSTEM] Pressure adjusted to " << pressure << "/10");
 }
 
 int LegacyIrrigationSystem::getPressure() const
@@ -55,15 +55,9 @@ bool LegacyIrrigationSystem::checkMoisture(int zoneId, int daysSinceLastWater)
     // Simple moisture logic based on days since last watering
     bool needsWater = daysSinceLastWater > 5;
 
-    std::cout << "[LEGACY SYSTEM] Moisture check - Zone " << zoneId << ": ";
-    if (needsWater)
-    {
-        std::cout << "DRY (last watered " << daysSinceLastWater << " days ago)" << std::endl;
-    }
-    else
-    {
-        std::cout << "OK (last watered " << daysSinceLastWater << " days ago)" << std::endl;
-    }
+    LOG_INFO("[LEGACY SYSTEM] Moisture check - Zone " << zoneId << ": "
+             << (needsWater ? "DRY" : "OK")
+             << " (last watered " << daysSinceLastWater << " days ago)");
 
     return needsWater;
 }
@@ -72,12 +66,12 @@ void LegacyIrrigationSystem::setMode(const std::string &mode)
 {
     if (mode != "manual" && mode != "timer" && mode != "sensor")
     {
-        std::cout << "[LEGACY SYSTEM] ERROR: Invalid mode. Use 'manual', 'timer', or 'sensor'" << std::endl;
+        LOG_ERROR("[LEGACY SYSTEM] ERROR: Invalid mode. Use 'manual', 'timer', or 'sensor'");
         return;
     }
 
     systemMode = mode;
-    std::cout << "[LEGACY SYSTEM] Operating mode set to: " << mode << std::endl;
+    LOG_INFO("[LEGACY SYSTEM] Operating mode set to: " << mode);
 }
 
 std::string LegacyIrrigationSystem::getMode() const
@@ -97,10 +91,10 @@ std::string LegacyIrrigationSystem::getStatus() const
 
 bool LegacyIrrigationSystem::runDiagnostic()
 {
-    std::cout << "[LEGACY SYSTEM] Running diagnostic..." << std::endl;
-    std::cout << "[LEGACY SYSTEM] Checking valves... OK" << std::endl;
-    std::cout << "[LEGACY SYSTEM] Checking pressure... OK" << std::endl;
-    std::cout << "[LEGACY SYSTEM] Checking zones... OK" << std::endl;
-    std::cout << "[LEGACY SYSTEM] Diagnostic complete - All systems operational" << std::endl;
+    LOG_INFO("[LEGACY SYSTEM] Running diagnostic...");
+    LOG_INFO("[LEGACY SYSTEM] Checking valves... OK");
+    LOG_INFO("[LEGACY SYSTEM] Checking pressure... OK");
+    LOG_INFO("[LEGACY SYSTEM] Checking zones... OK");
+    LOG_INFO("[LEGACY SYSTEM] Diagnostic complete - All systems operational");
     return true;
 }
\ No newline at end of file
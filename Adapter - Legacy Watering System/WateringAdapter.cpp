@@ -1,35 +1,35 @@
 #include "WateringAdapter.h"
 #include "../Composite - The Store layout/GreenhouseComponent.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 #include <sstream>
 #include <iomanip>
 
 WateringAdapter::WateringAdapter(LegacyIrrigationSystem *legacy)
     : legacySystem(legacy), zoneCounter(1), seasonalMultiplier(1.0), currentSeason("spring")
 {
-    std::cout << "\n=== ADAPTER INITIALIZED ===" << std::endl;
-    std::cout << "WateringAdapter: Wrapping legacy irrigation system" << std::endl;
-    std::cout << "WateringAdapter: Ready to translate modern commands to legacy format" << std::endl;
+    LOG_INFO("=== ADAPTER INITIALIZED ===");
+    LOG_INFO("WateringAdapter: Wrapping legacy irrigation system");
+    LOG_INFO("WateringAdapter: Ready to translate modern commands to legacy format");
     legacySystem->setMode("manual");
 }
 
 WateringAdapter::~WateringAdapter()
 {
-    std::cout << "WateringAdapter: Shutting down adapter" << std::endl;
+    LOG_INFO("WateringAdapter: Shutting down adapter");
 }
 
 void WateringAdapter::waterGreenhouse(GreenhouseComponent *greenhouse)
 {
-    std::cout << "\n================================================" << std::endl;
-    std::cout << "  ADAPTER: AUTO-WATERING CYCLE STARTED" << std::endl;
-    std::cout << "================================================" << std::endl;
-    std::cout << "ADAPTER: Translating modern watering requests..." << std::endl;
-    std::cout << "ADAPTER: Current season: " << currentSeason << std::endl;
-    std::cout << "ADAPTER: Seasonal multiplier: " << seasonalMultiplier << "x" << std::endl;
+    LOG_INFO("================================================");
+    LOG_INFO("  ADAPTER: AUTO-WATERING CYCLE STARTED");
+    LOG_INFO("================================================");
+    LOG_INFO("ADAPTER: Translating modern watering requests...");
+    LOG_INFO("ADAPTER: Current season: " << currentSeason);
+    LOG_INFO("ADAPTER: Seasonal multiplier: " << std::fixed << std::setprecision(2) << seasonalMultiplier << "x");
 
     if (greenhouse == nullptr)
     {
-        std::cout << "ADAPTER: ERROR - No greenhouse provided" << std::endl;
+        LOG_ERROR("ADAPTER: ERROR - No greenhouse provided");
         return;
     }
 
@@ -39,8 +39,8 @@ void WateringAdapter::waterGreenhouse(GreenhouseComponent *greenhouse)
     // Calculate base duration based on season
     int baseDuration = static_cast<int>(10 * seasonalMultiplier);
 
-    std::cout << "\nADAPTER: Activating irrigation zones..." << std::endl;
-    std::cout << "ADAPTER: Base duration: " << baseDuration << " minutes" << std::endl;
+    LOG_INFO("ADAPTER: Activating irrigation zones...");
+    LOG_INFO("ADAPTER: Base duration: " << baseDuration << " minutes");
 
     // Activate zones - the greenhouse component decides what needs watering
     for (int zone = 1; zone <= zoneCounter; zone++)
@@ -48,16 +48,16 @@ void WateringAdapter::waterGreenhouse(GreenhouseComponent *greenhouse)
         legacySystem->activateZone(zone, baseDuration);
     }
 
-    std::cout << "\n================================================" << std::endl;
-    std::cout << "  ADAPTER: WATERING CYCLE COMPLETE" << std::endl;
-    std::cout << "================================================" << std::endl;
+    LOG_INFO("================================================");
+    LOG_INFO("  ADAPTER: WATERING CYCLE COMPLETE");
+    LOG_INFO("================================================");
 }
 
 void WateringAdapter::adjustForSeason(const std::string &season)
 {
-    std::cout << "\n=== ADAPTER: SEASONAL ADJUSTMENT ===" << std::endl;
-    std::cout << "ADAPTER: Adjusting from '" << currentSeason
-              << "' to '" << season << "'" << std::endl;
+    LOG_INFO("=== ADAPTER: SEASONAL ADJUSTMENT ===");
+    LOG_INFO("ADAPTER: Adjusting from '" << currentSeason
+             << "' to '" << season << "'");
 
     currentSeason = season;
 
@@ -66,33 +66,33 @@ void WateringAdapter::adjustForSeason(const std::string &season)
     {
         seasonalMultiplier = 1.5;
         legacySystem->setPressure(7);
-        std::cout << "ADAPTER: Summer mode - Increased watering (1.5x)" << std::endl;
+        LOG_INFO("ADAPTER: Summer mode - Increased watering (1.5x)");
     }
     else if (season == "winter")
     {
         seasonalMultiplier = 0.6;
         legacySystem->setPressure(4);
-        std::cout << "ADAPTER: Winter mode - Reduced watering (0.6x)" << std::endl;
+        LOG_INFO("ADAPTER: Winter mode - Reduced watering (0.6x)");
     }
     else if (season == "spring")
     {
         seasonalMultiplier = 1.0;
         legacySystem->setPressure(5);
-        std::cout << "ADAPTER: Spring mode - Normal watering (1.0x)" << std::endl;
+        LOG_INFO("ADAPTER: Spring mode - Normal watering (1.0x)");
     }
     else if (season == "fall" || season == "autumn")
     {
         seasonalMultiplier = 0.8;
         legacySystem->setPressure(5);
-        std::cout << "ADAPTER: Fall mode - Slightly reduced watering (0.8x)" << std::endl;
+        LOG_INFO("ADAPTER: Fall mode - Slightly reduced watering (0.8x)");
     }
     else
     {
         seasonalMultiplier = 1.0;
-        std::cout << "ADAPTER: Unknown season - Using default settings" << std::endl;
+        LOG_INFO("ADAPTER: Unknown season - Using default settings");
     }
 
-    std::cout << "ADAPTER: Seasonal multiplier set to " << seasonalMultiplier << "x" << std::endl;
+    LOG_INFO("ADAPTER: Seasonal multiplier set to " << std::fixed << std::setprecision(2) << seasonalMultiplier << "x");
 }
 
 std::string WateringAdapter::getSystemStatus()
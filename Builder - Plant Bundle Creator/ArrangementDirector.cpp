@@ -1,7 +1,7 @@
 #include "ArrangementDirector.h"
 #include "PlantArrangementBuilder.h"
 #include "PlantArrangement.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 ArrangementDirector::ArrangementDirector() : builder(nullptr) {}
 
@@ -11,16 +11,16 @@ ArrangementDirector::~ArrangementDirector() {
 
 void ArrangementDirector::setBuilder(PlantArrangementBuilder* b) {
     builder = b;
-    std::cout << "[Director] Builder set successfully" << std::endl;
+    LOG_INFO("[Director] Builder set successfully");
 }
 
 PlantArrangement* ArrangementDirector::constructSimpleArrangement() {
     if (builder == nullptr) {
-        std::cerr << "[Director] Error: No builder set!" << std::endl;
+        LOG_ERROR("[Director] Error: No builder set!");
         return nullptr;
     }
 
-    std::cout << "\n[Director] Constructing SIMPLE arrangement..." << std::endl;
+    LOG_INFO("[Director] Constructing SIMPLE arrangement...");
 
     builder->reset();
     builder->setBasicInfo();
@@ -28,17 +28,17 @@ PlantArrangement* ArrangementDirector::constructSimpleArrangement() {
     builder->addPlants();
     builder->calculatePrice();
 
-    std::cout << "[Director] Simple arrangement complete!\n" << std::endl;
+    LOG_INFO("[Director] Simple arrangement complete!");
     return builder->getArrangement();
 }
 
 PlantArrangement* ArrangementDirector::constructDeluxeArrangement() {
     if (builder == nullptr) {
-        std::cerr << "[Director] Error: No builder set!" << std::endl;
+        LOG_ERROR("[Director] Error: No builder set!");
         return nullptr;
     }
 
-    std::cout << "\n[Director] Constructing DELUXE arrangement..." << std::endl;
+    LOG_INFO("[Director] Constructing DELUXE arrangement...");
 
     builder->reset();
     builder->setBasicInfo();
@@ -47,17 +47,17 @@ PlantArrangement* ArrangementDirector::constructDeluxeArrangement() {
     builder->addDecorations();  // Deluxe includes decorations
     builder->calculatePrice();
 
-    std::cout << "[Director] Deluxe arrangement complete!\n" << std::endl;
+    LOG_INFO("[Director] Deluxe arrangement complete!");
     return builder->getArrangement();
 }
 
 PlantArrangement* ArrangementDirector::constructCustomArrangement(bool includeDecorations) {
     if (builder == nullptr) {
-        std::cerr << "[Director] Error: No builder set!" << std::endl;
+        LOG_ERROR("[Director] Error: No builder set!");
         return nullptr;
     }
 
-    std::cout << "\n[Director] Constructing CUSTOM arrangement..." << std::endl;
+    LOG_INFO("[Director] Constructing CUSTOM arrangement...");
 
     builder->reset();
     builder->setBasicInfo();
@@ -70,6 +70,6 @@ PlantArrangement* ArrangementDirector::constructCustomArrangement(bool includeDe
 
     builder->calculatePrice();
 
-    std::cout << "[Director] Custom arrangement complete!\n" << std::endl;
+    LOG_INFO("[Director] Custom arrangement complete!");
     return builder->getArrangement();
 }
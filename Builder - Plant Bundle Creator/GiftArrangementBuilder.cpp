@@ -1,7 +1,8 @@
 #include "GiftArrangementBuilder.h"
 #include "PlantArrangement.h"
 #include "../Plant - Abstract Base/Plant.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
+#include <iomanip>
 
 GiftArrangementBuilder::GiftArrangementBuilder() : PlantArrangementBuilder() {}
 
@@ -13,42 +14,42 @@ void GiftArrangementBuilder::setAvailablePlants(const std::vector<Plant*>& plant
 
 void GiftArrangementBuilder::reset() {
     arrangement = new PlantArrangement();
-    std::cout << "[GiftBuilder] Creating new gift arrangement..." << std::endl;
+    LOG_INFO("[GiftBuilder] Creating new gift arrangement...");
 }
 
 void GiftArrangementBuilder::setBasicInfo() {
     arrangement->setName("Premium Gift Arrangement");
     arrangement->setDescription("Beautiful gift arrangement perfect for any occasion");
-    std::cout << "[GiftBuilder] Set gift arrangement info" << std::endl;
+    LOG_INFO("[GiftBuilder] Set gift arrangement info");
 }
 
 void GiftArrangementBuilder::selectContainer() {
     arrangement->setContainerType("decorative_basket");
-    std::cout << "[GiftBuilder] Selected decorative basket container" << std::endl;
+    LOG_INFO("[GiftBuilder] Selected decorative basket container");
 }
 
 void GiftArrangementBuilder::addPlants() {
     // Gift arrangements typically have 3-5 smaller plants
     int targetCount = 3;
 
-    std::cout << "[GiftBuilder] Adding " << targetCount << " plants for gift..." << std::endl;
+    LOG_INFO("[GiftBuilder] Adding " << targetCount << " plants for gift...");
 
     for (int i = 0; i < targetCount && i < availablePlants.size(); i++) {
         arrangement->addPlant(availablePlants[i]);
-        std::cout << "  - Added plant " << (i + 1) << std::endl;
+        LOG_INFO("  - Added plant " << (i + 1));
     }
 }
 
 void GiftArrangementBuilder::addDecorations() {
     // Gift arrangements include decorative elements
-    std::cout << "[GiftBuilder] Adding gift decorations:" << std::endl;
-    std::cout << "  - Ribbon and bow" << std::endl;
-    std::cout << "  - Greeting card" << std::endl;
-    std::cout << "  - Tissue paper wrapping" << std::endl;
+    LOG_INFO("[GiftBuilder] Adding gift decorations:");
+    LOG_INFO("  - Ribbon and bow");
+    LOG_INFO("  - Greeting card");
+    LOG_INFO("  - Tissue paper wrapping");
 }
 
 void GiftArrangementBuilder::calculatePrice() {
     double basePrice = 150.0;  // Gift presentation adds value
     arrangement->setBasePrice(basePrice);
-    std::cout << "[GiftBuilder] Calculated base price: R" << basePrice << std::endl;
+    LOG_INFO("[GiftBuilder] Calculated base price: R" << std::fixed << std::setprecision(2) << basePrice);
 }
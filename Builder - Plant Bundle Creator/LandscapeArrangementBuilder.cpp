@@ -1,7 +1,8 @@
 #include "LandscapeArrangementBuilder.h"
 #include "PlantArrangement.h"
 #include "../Plant - Abstract Base/Plant.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
+#include <iomanip>
 
 LandscapeArrangementBuilder::LandscapeArrangementBuilder()
     : PlantArrangementBuilder(), landscapeTheme("mixed") {}
@@ -18,42 +19,42 @@ void LandscapeArrangementBuilder::setTheme(const std::string& theme) {
 
 void LandscapeArrangementBuilder::reset() {
     arrangement = new PlantArrangement();
-    std::cout << "[LandscapeBuilder] Creating new landscape arrangement..." << std::endl;
+    LOG_INFO("[LandscapeBuilder] Creating new landscape arrangement...");
 }
 
 void LandscapeArrangementBuilder::setBasicInfo() {
     arrangement->setName("Landscape Collection - " + landscapeTheme);
     arrangement->setDescription("Professional landscape arrangement for outdoor spaces");
-    std::cout << "[LandscapeBuilder] Set landscape info with theme: " << landscapeTheme << std::endl;
+    LOG_INFO("[LandscapeBuilder] Set landscape info with theme: " << landscapeTheme);
 }
 
 void LandscapeArrangementBuilder::selectContainer() {
     arrangement->setContainerType("large_planter_box");
-    std::cout << "[LandscapeBuilder] Selected large planter box" << std::endl;
+    LOG_INFO("[LandscapeBuilder] Selected large planter box");
 }
 
 void LandscapeArrangementBuilder::addPlants() {
     // Landscape arrangements have more plants (7-10)
     int targetCount = 7;
 
-    std::cout << "[LandscapeBuilder] Adding " << targetCount << " plants for landscaping..." << std::endl;
+    LOG_INFO("[LandscapeBuilder] Adding " << targetCount << " plants for landscaping...");
 
     for (int i = 0; i < targetCount && i < availablePlants.size(); i++) {
         arrangement->addPlant(availablePlants[i]);
-        std::cout << "  - Added plant " << (i + 1) << std::endl;
+        LOG_INFO("  - Added plant " << (i + 1));
     }
 }
 
 void LandscapeArrangementBuilder::addDecorations() {
     // Landscape arrangements have functional decorations
-    std::cout << "[LandscapeBuilder] Adding landscape elements:" << std::endl;
-    std::cout << "  - Decorative stones" << std::endl;
-    std::cout << "  - Mulch layer" << std::endl;
-    std::cout << "  - Plant markers" << std::endl;
+    LOG_INFO("[LandscapeBuilder] Adding landscape elements:");
+    LOG_INFO("  - Decorative stones");
+    LOG_INFO("  - Mulch layer");
+    LOG_INFO("  - Plant markers");
 }
 
 void LandscapeArrangementBuilder::calculatePrice() {
     double basePrice = 500.0;  // Landscape arrangements are more expensive
     arrangement->setBasePrice(basePrice);
-    std::cout << "[LandscapeBuilder] Calculated base price: R" << basePrice << std::endl;
+    LOG_INFO("[LandscapeBuilder] Calculated base price: R" << std::fixed << std::setprecision(2) << basePrice);
 }
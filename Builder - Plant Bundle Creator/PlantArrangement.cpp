@@ -28,7 +28,7 @@ void PlantArrangement::setContainerType(const std::string& container) {
 
 void PlantArrangement::addPlant(Plant* plant) {
     if (plant != nullptr) {
-        plants.push_back(plant);
+        plants.push_back(PlantHandle(plant));
     }
 }
 
@@ -46,19 +46,32 @@ double PlantArrangement::getBasePrice() const {
 
 double PlantArrangement::getTotalPrice() const {
     // In a real system, you'd get plant prices too
-    return basePrice + (plants.size() * 50.0); // Simplified
+    return basePrice + (getPlantCount() * 50.0); // Simplified
 }
 
 std::string PlantArrangement::getContainerType() const {
     return containerType;
 }
 
-const std::vector<Plant*>& PlantArrangement::getPlants() const {
-    return plants;
+std::vector<Plant*> PlantArrangement::getPlants() const {
+    std::vector<Plant*> live;
+    live.reserve(plants.size());
+    for (const PlantHandle& handle : plants) {
+        if (Plant* plant = handle.get()) {
+            live.push_back(plant);
+        }
+    }
+    return live;
 }
 
 int PlantArrangement::getPlantCount() const {
-    return plants.size();
+    int count = 0;
+    for (const PlantHandle& handle : plants) {
+        if (handle) {
+            count++;
+        }
+    }
+    return count;
 }
 
 void PlantArrangement::display() const {
@@ -66,7 +79,7 @@ void PlantArrangement::display() const {
     std::cout << "Name: " << name << std::endl;
     std::cout << "Description: " << description << std::endl;
     std::cout << "Container: " << containerType << std::endl;
-    std::cout << "Number of Plants: " << plants.size() << std::endl;
+    std::cout << "Number of Plants: " << getPlantCount() << std::endl;
     std::cout << "Base Price: R" << std::fixed << std::setprecision(2) << basePrice << std::endl;
     std::cout << "Total Price: R" << std::fixed << std::setprecision(2) << getTotalPrice() << std::endl;
 }
@@ -1,5 +1,6 @@
 #ifndef PLANTARRANGEMENT_H
 #define PLANTARRANGEMENT_H
+#include "../Plant - Abstract Base/PlantHandle.h"
 #include <vector>
 #include <string>
 
@@ -7,7 +8,7 @@ class Plant;
 
 class PlantArrangement {
 private:
-    std::vector<Plant*> plants;
+    std::vector<PlantHandle> plants;   // Destroyed plants drop out of the arrangement
     std::string name;
     std::string description;
     double basePrice;
@@ -30,7 +31,7 @@ public:
     double getBasePrice() const;
     double getTotalPrice() const;
     std::string getContainerType() const;
-    const std::vector<Plant*>& getPlants() const;
+    std::vector<Plant*> getPlants() const;      // Plants that still exist
     int getPlantCount() const;
     void display() const;
 };
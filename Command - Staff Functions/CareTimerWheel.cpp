@@ -0,0 +1,211 @@
+#include "CareTimerWheel.h"
+#include "../Plant - Abstract Base/PlantStore.h"
+#include <utility>
+
+CareTimerWheel::CareTimerWheel(PlantStore& s) : store(&s), currentDay(0), columnDay(0) {
+    store->setCareSchedule(this);
+    size_t count = store->capacity();
+    for (size_t slot = 0; slot < count; slot++) {
+        if (store->getPlant(slot)) {
+            rescheduleAll(slot);
+        }
+    }
+}
+
+CareTimerWheel::~CareTimerWheel() {
+    if (store && store->getCareSchedule() == this) {
+        store->setCareSchedule(nullptr);
+    }
+}
+
+int64_t CareTimerWheel::getCurrentDay() const {
+    return currentDay;
+}
+
+// ========== SCHEDULING ==========
+
+void CareTimerWheel::reschedule(size_t slot, CareTask task) {
+    ensureSlot(slot);
+    int t = static_cast<int>(task);
+    uint32_t version = ++versions[t][slot];  // Any queued entry for this task is now stale
+    clearDue(slot, task);
+
+    int64_t due = computeDueDay(slot, task);
+    if (due == NEVER) {
+        return;
+    }
+    if (due <= currentDay) {
+        markDue(slot, task);
+    } else {
+        insert({due, static_cast<uint32_t>(slot), version, task});
+    }
+}
+
+void CareTimerWheel::rescheduleAll(size_t slot) {
+    reschedule(slot, CareTask::Water);
+    reschedule(slot, CareTask::Fertilize);
+    reschedule(slot, CareTask::Prune);
+}
+
+void CareTimerWheel::cancel(size_t slot) {
+    if (slot >= versions[0].size()) {
+        return;
+    }
+    for (int t = 0; t < TASK_COUNT; t++) {
+        versions[t][slot]++;
+        clearDue(slot, static_cast<CareTask>(t));
+    }
+}
+
+int64_t CareTimerWheel::computeDueDay(size_t slot, CareTask task) const {
+    const PlantStore& s = *store;
+    switch (task) {
+        case CareTask::Water:
+        case CareTask::Fertilize: {
+            bool water = task == CareTask::Water;
+            int every = water ? s.wateringFrequency[slot] : s.fertilizingFrequency[slot];
+            int done = water ? s.timesWatered[slot] : s.timesFertilized[slot];
+            if (every <= 0) {
+                return NEVER;
+            }
+            // needsWater()/needsFertilizer(): done < age / every  <=>  age >= (done + 1) * every
+            int64_t threshold = static_cast<int64_t>(done + 1) * every;
+            int64_t remaining = threshold - s.age[slot];
+            return columnDay + (remaining > 0 ? remaining : 0);
+        }
+        case CareTask::Prune: {
+            double height = s.height[slot];
+            if (s.timesPruned[slot] >= 3 || height != height) {
+                return NEVER;
+            }
+            if (height > 50.0) {
+                return columnDay;
+            }
+            // Earliest day natural growth (0.5cm/day) can take it past 50cm;
+            // re-checked when it expires in case growth stalled
+            double days = (50.0 - height) / 0.5;
+            if (days > 1e12) {
+                days = 1e12;
+            }
+            return columnDay + static_cast<int64_t>(days) + 1;
+        }
+    }
+    return NEVER;
+}
+
+// ========== WHEEL MECHANICS ==========
+
+void CareTimerWheel::insert(const Entry& entry) {
+    if (entry.due <= currentDay) {
+        nearWheel[currentDay & WHEEL_MASK].push_back(entry);
+    } else if ((entry.due >> WHEEL_BITS) == (currentDay >> WHEEL_BITS)) {
+        nearWheel[entry.due & WHEEL_MASK].push_back(entry);
+    } else if ((entry.due >> (2 * WHEEL_BITS)) == (currentDay >> (2 * WHEEL_BITS))) {
+        farWheel[(entry.due >> WHEEL_BITS) & WHEEL_MASK].push_back(entry);
+    } else {
+        overflow.push_back(entry);
+    }
+}
+
+void CareTimerWheel::cascade(std::vector<Entry>& bucket) {
+    std::vector<Entry> moving;
+    moving.swap(bucket);
+    for (const Entry& entry : moving) {
+        if (entry.version == versions[static_cast<int>(entry.task)][entry.slot]) {
+            insert(entry);
+        }
+    }
+}
+
+void CareTimerWheel::expire(const Entry& entry) {
+    int t = static_cast<int>(entry.task);
+    if (entry.version != versions[t][entry.slot] || !store->getPlant(entry.slot)) {
+        return;  // Rescheduled or released since this entry was queued
+    }
+
+    int64_t due = computeDueDay(entry.slot, entry.task);
+    if (due == NEVER) {
+        return;
+    }
+    if (due <= currentDay) {
+        markDue(entry.slot, entry.task);
+    } else {
+        insert({due, entry.slot, entry.version, entry.task});
+    }
+}
+
+void CareTimerWheel::advance(int days) {
+    if (days <= 0) {
+        return;
+    }
+    // tickAll() has already applied every day to the columns, so due days
+    // recomputed along the way are measured from the end of the advance
+    columnDay = currentDay + days;
+    for (int d = 0; d < days; d++) {
+        currentDay++;
+
+        if ((currentDay & FAR_MASK) == 0) {
+            cascade(overflow);
+        }
+        if ((currentDay & WHEEL_MASK) == 0) {
+            cascade(farWheel[(currentDay >> WHEEL_BITS) & WHEEL_MASK]);
+        }
+
+        std::vector<Entry> expiring;
+        expiring.swap(nearWheel[currentDay & WHEEL_MASK]);
+        for (const Entry& entry : expiring) {
+            expire(entry);
+        }
+    }
+}
+
+// ========== DUE LISTS ==========
+
+void CareTimerWheel::ensureSlot(size_t slot) {
+    if (slot < versions[0].size()) {
+        return;
+    }
+    for (int t = 0; t < TASK_COUNT; t++) {
+        versions[t].resize(slot + 1, 0);
+        duePosition[t].resize(slot + 1, NOT_DUE);
+    }
+}
+
+void CareTimerWheel::markDue(size_t slot, CareTask task) {
+    int t = static_cast<int>(task);
+    if (duePosition[t][slot] == NOT_DUE) {
+        duePosition[t][slot] = dueList[t].size();
+        dueList[t].push_back(slot);
+    }
+}
+
+void CareTimerWheel::clearDue(size_t slot, CareTask task) {
+    int t = static_cast<int>(task);
+    size_t pos = duePosition[t][slot];
+    if (pos == NOT_DUE) {
+        return;
+    }
+    size_t last = dueList[t].back();
+    dueList[t][pos] = last;
+    duePosition[t][last] = pos;
+    dueList[t].pop_back();
+    duePosition[t][slot] = NOT_DUE;
+}
+
+const std::vector<size_t>& CareTimerWheel::getDueSlots(CareTask task) const {
+    return dueList[static_cast<int>(task)];
+}
+
+std::vector<Plant*> CareTimerWheel::getDuePlants(CareTask task) const {
+    const std::vector<size_t>& slots = dueList[static_cast<int>(task)];
+    std::vector<Plant*> plants;
+    plants.reserve(slots.size());
+    for (size_t slot : slots) {
+        plants.push_back(store->getPlant(slot));
+    }
+    return plants;
+}
+
+size_t CareTimerWheel::getDueCount(CareTask task) const {
+    return dueList[static_cast<int>(task)].size();
+}
@@ -0,0 +1,133 @@
+#ifndef CARETIMERWHEEL_H
+#define CARETIMERWHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Plant;
+class PlantStore;
+
+/**
+ * @brief Care actions tracked by the CareTimerWheel
+ */
+enum class CareTask {
+    Water = 0,
+    Fertilize = 1,
+    Prune = 2
+};
+
+/**
+ * @brief Hierarchical timing wheel of plant care due dates, keyed by simulation day
+ *
+ * Holds the next watering, fertilizing and pruning due day of every plant in a
+ * PlantStore. Care actions and care-requirement setters reschedule the affected
+ * plant in O(1); PlantStore::tickAll() advances the wheel, which only touches the
+ * entries that expire on each day. Plants whose care has come due stay in a due
+ * list until they are cared for, so "who needs water today" costs O(plants due)
+ * instead of an O(N) needsWater() scan.
+ *
+ * Two wheel levels of 64 buckets cover 4096 days; later entries wait in an
+ * overflow list. Rescheduled entries are invalidated lazily by a per-plant
+ * version counter and every expiring entry is re-checked against the columns.
+ */
+class CareTimerWheel {
+private:
+    struct Entry {
+        int64_t due;
+        uint32_t slot;
+        uint32_t version;
+        CareTask task;
+    };
+
+    static constexpr int WHEEL_BITS = 6;
+    static constexpr int WHEEL_SIZE = 1 << WHEEL_BITS;         // 64 buckets per level
+    static constexpr int64_t WHEEL_MASK = WHEEL_SIZE - 1;
+    static constexpr int64_t FAR_MASK = (int64_t(1) << (2 * WHEEL_BITS)) - 1;  // 4096-day span
+
+    static constexpr int TASK_COUNT = 3;
+    static constexpr size_t NOT_DUE = static_cast<size_t>(-1);
+    static constexpr int64_t NEVER = -1;
+
+    PlantStore* store;
+    int64_t currentDay;
+    int64_t columnDay;                           // Day the store columns reflect (ahead of currentDay mid-advance)
+
+    std::vector<Entry> nearWheel[WHEEL_SIZE];    // Level 0: one bucket per day
+    std::vector<Entry> farWheel[WHEEL_SIZE];     // Level 1: one bucket per 64 days
+    std::vector<Entry> overflow;                 // Beyond 4096 days
+
+    std::vector<uint32_t> versions[TASK_COUNT];  // Current entry version per slot
+    std::vector<size_t> dueList[TASK_COUNT];     // Slots whose care is due
+    std::vector<size_t> duePosition[TASK_COUNT]; // Index into dueList (NOT_DUE if absent)
+
+    void ensureSlot(size_t slot);
+    void insert(const Entry& entry);
+    void cascade(std::vector<Entry>& bucket);
+    void expire(const Entry& entry);
+    int64_t computeDueDay(size_t slot, CareTask task) const;
+    void markDue(size_t slot, CareTask task);
+    void clearDue(size_t slot, CareTask task);
+
+public:
+    /**
+     * @brief Attach a wheel to a store and schedule every live plant
+     * @param store Store whose plants are tracked
+     */
+    explicit CareTimerWheel(PlantStore& store);
+
+    /**
+     * @brief Detach from the store
+     */
+    ~CareTimerWheel();
+
+    CareTimerWheel(const CareTimerWheel&) = delete;
+    CareTimerWheel& operator=(const CareTimerWheel&) = delete;
+
+    /**
+     * @brief Current simulation day of the wheel
+     */
+    int64_t getCurrentDay() const;
+
+    /**
+     * @brief Move the wheel forward, collecting the care that comes due
+     * @param days Number of simulation days
+     */
+    void advance(int days = 1);
+
+    /**
+     * @brief Recompute one care due date after the plant's columns changed
+     * @param slot Store slot of the plant
+     * @param task Care task to recompute
+     */
+    void reschedule(size_t slot, CareTask task);
+
+    /**
+     * @brief Recompute every care due date of a plant
+     * @param slot Store slot of the plant
+     */
+    void rescheduleAll(size_t slot);
+
+    /**
+     * @brief Forget a plant (its slot was released)
+     * @param slot Store slot of the plant
+     */
+    void cancel(size_t slot);
+
+    /**
+     * @brief Store slots currently due for a task
+     */
+    const std::vector<size_t>& getDueSlots(CareTask task) const;
+
+    /**
+     * @brief Plants currently due for a task (a copy, safe to care for while iterating)
+     */
+    std::vector<Plant*> getDuePlants(CareTask task) const;
+
+    /**
+     * @brief Number of plants currently due for a task
+     */
+    size_t getDueCount(CareTask task) const;
+};
+
+#endif // CARETIMERWHEEL_H
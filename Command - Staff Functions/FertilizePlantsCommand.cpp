@@ -1,12 +1,19 @@
 #include "FertilizePlantsCommand.h"
 #include "PlantCareStaff.h"
+#include "CareTimerWheel.h"
 
 FertilizePlantsCommand::FertilizePlantsCommand(PlantCareStaff* staff)
-    : receiver(staff) {
+    : receiver(staff), schedule(nullptr) {
+}
+
+FertilizePlantsCommand::FertilizePlantsCommand(PlantCareStaff* staff, CareTimerWheel* dueSchedule)
+    : receiver(staff), schedule(dueSchedule) {
 }
 
 void FertilizePlantsCommand::execute() {
-    if (receiver) {
+    if (receiver && schedule) {
+        receiver->fertilizePlants(schedule->getDuePlants(CareTask::Fertilize));
+    } else if (receiver) {
         receiver->fertilizePlants();
     }
 }
@@ -3,13 +3,16 @@
 #include "StaffCommand.h"
 
 class PlantCareStaff;
+class CareTimerWheel;
 
 class FertilizePlantsCommand : public StaffCommand {
 private:
     PlantCareStaff* receiver;
+    CareTimerWheel* schedule;  // When set, only the plants due for care are handled
     
 public:
     FertilizePlantsCommand(PlantCareStaff* staff);
+    FertilizePlantsCommand(PlantCareStaff* staff, CareTimerWheel* dueSchedule);
     virtual ~FertilizePlantsCommand() = default;
     
     void execute() override;
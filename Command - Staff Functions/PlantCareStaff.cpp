@@ -1,22 +1,50 @@
 #include "PlantCareStaff.h"
-#include <iostream>
+#include "../Plant - Abstract Base/Plant.h"
+#include "../Core - Simulation Services/Logger.h"
 
 PlantCareStaff::PlantCareStaff(const std::string& memberName)
     : StaffMember(memberName, "Plant Care") {
 }
 
 void PlantCareStaff::performDuties() {
-    std::cout << name << " is performing plant care duties..." << std::endl;
+    LOG_INFO(name << " is performing plant care duties...");
 }
 
 void PlantCareStaff::waterPlants() {
-    std::cout << name << " is watering the plants." << std::endl;
+    LOG_INFO(name << " is watering the plants.");
 }
 
 void PlantCareStaff::prunePlants() {
-    std::cout << name << " is pruning the plants." << std::endl;
+    LOG_INFO(name << " is pruning the plants.");
 }
 
 void PlantCareStaff::fertilizePlants() {
-    std::cout << name << " is fertilizing the plants." << std::endl;
+    LOG_INFO(name << " is fertilizing the plants.");
+}
+
+void PlantCareStaff::waterPlants(const std::vector<Plant*>& plants) {
+    LOG_INFO(name << " is watering " << plants.size() << " plant(s) that are due.");
+    for (Plant* plant : plants) {
+        if (plant) {
+            plant->water();
+        }
+    }
+}
+
+void PlantCareStaff::prunePlants(const std::vector<Plant*>& plants) {
+    LOG_INFO(name << " is pruning " << plants.size() << " plant(s) that are due.");
+    for (Plant* plant : plants) {
+        if (plant) {
+            plant->prune();
+        }
+    }
+}
+
+void PlantCareStaff::fertilizePlants(const std::vector<Plant*>& plants) {
+    LOG_INFO(name << " is fertilizing " << plants.size() << " plant(s) that are due.");
+    for (Plant* plant : plants) {
+        if (plant) {
+            plant->fertilize();
+        }
+    }
 }
@@ -1,11 +1,13 @@
 #ifndef PLANTCARESTAFF_H
 #define PLANTCARESTAFF_H
 #include "StaffMember.h"
+#include <vector>
 
 class WaterPlantsCommand;
 class PrunePlantsCommand;
 class FertilizePlantsCommand;
 class PlantCareContext;
+class Plant;
 
 class PlantCareStaff : public StaffMember {
 public:
@@ -16,6 +18,11 @@ public:
     void waterPlants();
     void prunePlants();
     void fertilizePlants();
+
+    // Care for specific plants (e.g. those a CareTimerWheel reports as due)
+    void waterPlants(const std::vector<Plant*>& plants);
+    void prunePlants(const std::vector<Plant*>& plants);
+    void fertilizePlants(const std::vector<Plant*>& plants);
 };
 
 #endif // PLANTCARESTAFF_H
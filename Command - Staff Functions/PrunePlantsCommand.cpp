@@ -1,12 +1,19 @@
 #include "PrunePlantsCommand.h"
 #include "PlantCareStaff.h"
+#include "CareTimerWheel.h"
 
 PrunePlantsCommand::PrunePlantsCommand(PlantCareStaff* staff)
-    : receiver(staff) {
+    : receiver(staff), schedule(nullptr) {
+}
+
+PrunePlantsCommand::PrunePlantsCommand(PlantCareStaff* staff, CareTimerWheel* dueSchedule)
+    : receiver(staff), schedule(dueSchedule) {
 }
 
 void PrunePlantsCommand::execute() {
-    if (receiver) {
+    if (receiver && schedule) {
+        receiver->prunePlants(schedule->getDuePlants(CareTask::Prune));
+    } else if (receiver) {
         receiver->prunePlants();
     }
 }
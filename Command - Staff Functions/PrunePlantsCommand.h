@@ -3,13 +3,16 @@
 #include "StaffCommand.h"
 
 class PlantCareStaff;
+class CareTimerWheel;
 
 class PrunePlantsCommand : public StaffCommand {
 private:
     PlantCareStaff* receiver;
+    CareTimerWheel* schedule;  // When set, only the plants due for care are handled
     
 public:
     PrunePlantsCommand(PlantCareStaff* staff);
+    PrunePlantsCommand(PlantCareStaff* staff, CareTimerWheel* dueSchedule);
     virtual ~PrunePlantsCommand() = default;
     
     void execute() override;
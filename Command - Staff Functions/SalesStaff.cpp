@@ -1,14 +1,14 @@
 #include "SalesStaff.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 SalesStaff::SalesStaff(const std::string& memberName)
     : StaffMember(memberName, "Sales") {
 }
 
 void SalesStaff::performDuties() {
-    std::cout << name << " is performing sales duties..." << std::endl;
+    LOG_INFO(name << " is performing sales duties...");
 }
 
 void SalesStaff::assistCustomer() {
-    std::cout << name << " is assisting a customer." << std::endl;
+    LOG_INFO(name << " is assisting a customer.");
 }
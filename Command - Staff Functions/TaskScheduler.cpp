@@ -1,6 +1,6 @@
 #include "TaskScheduler.h"
 #include "StaffCommand.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 TaskScheduler::TaskScheduler() : routine(nullptr) {
 }
@@ -14,12 +14,12 @@ TaskScheduler::~TaskScheduler() {
 void TaskScheduler::addCommand(StaffCommand* command) {
     if (command) {
         commands.push_back(command);
-        std::cout << "Task added to scheduler." << std::endl;
+        LOG_INFO("Task added to scheduler.");
     }
 }
 
 void TaskScheduler::executeCommands() {
-    std::cout << "\n=== Executing Scheduled Tasks ===" << std::endl;
+    LOG_INFO("=== Executing Scheduled Tasks ===");
     for (auto command : commands) {
         if (command) {
             command->execute();
@@ -27,12 +27,12 @@ void TaskScheduler::executeCommands() {
         }
     }
     commands.clear();
-    std::cout << "=== All Tasks Complete ===\n" << std::endl;
+    LOG_INFO("=== All Tasks Complete ===");
 }
 
 void TaskScheduler::executeCommand(StaffCommand* command) {
     if (command) {
-        std::cout << "Executing immediate task..." << std::endl;
+        LOG_INFO("Executing immediate task...");
         command->execute();
         commandHistory.push_back(command);
     }
@@ -40,7 +40,7 @@ void TaskScheduler::executeCommand(StaffCommand* command) {
 
 void TaskScheduler::clearCommands() {
     commands.clear();
-    std::cout << "All scheduled tasks cleared." << std::endl;
+    LOG_INFO("All scheduled tasks cleared.");
 }
 
 int TaskScheduler::getCommandCount() const {
@@ -1,12 +1,19 @@
 #include "WaterPlantsCommand.h"
 #include "PlantCareStaff.h"
+#include "CareTimerWheel.h"
 
 WaterPlantsCommand::WaterPlantsCommand(PlantCareStaff* staff)
-    : receiver(staff) {
+    : receiver(staff), schedule(nullptr) {
+}
+
+WaterPlantsCommand::WaterPlantsCommand(PlantCareStaff* staff, CareTimerWheel* dueSchedule)
+    : receiver(staff), schedule(dueSchedule) {
 }
 
 void WaterPlantsCommand::execute() {
-    if (receiver) {
+    if (receiver && schedule) {
+        receiver->waterPlants(schedule->getDuePlants(CareTask::Water));
+    } else if (receiver) {
         receiver->waterPlants();
     }
 }
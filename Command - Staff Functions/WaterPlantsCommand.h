@@ -3,13 +3,16 @@
 #include "StaffCommand.h"
 
 class PlantCareStaff;
+class CareTimerWheel;
 
 class WaterPlantsCommand : public StaffCommand {
 private:
     PlantCareStaff* receiver;
+    CareTimerWheel* schedule;  // When set, only the plants due for care are handled
     
 public:
     WaterPlantsCommand(PlantCareStaff* staff);
+    WaterPlantsCommand(PlantCareStaff* staff, CareTimerWheel* dueSchedule);
     virtual ~WaterPlantsCommand() = default;
     
     void execute() override;
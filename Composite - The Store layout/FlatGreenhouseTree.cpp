@@ -0,0 +1,261 @@
+#include "FlatGreenhouseTree.h"
+#include "GreenhouseComponent.h"
+#include "Greenhouse.h"
+#include "GreenhouseSection.h"
+#include "Shelf.h"
+#include "PlantLeaf.h"
+#include <utility>
+
+namespace {
+    GreenhouseNodeKind kindOf(const GreenhouseComponent* component) {
+        if (dynamic_cast<const PlantLeaf*>(component)) {
+            return GreenhouseNodeKind::Plant;
+        }
+        if (dynamic_cast<const Shelf*>(component)) {
+            return GreenhouseNodeKind::Shelf;
+        }
+        if (dynamic_cast<const GreenhouseSection*>(component)) {
+            return GreenhouseNodeKind::Section;
+        }
+        if (dynamic_cast<const Greenhouse*>(component)) {
+            return GreenhouseNodeKind::Greenhouse;
+        }
+        return GreenhouseNodeKind::Other;
+    }
+}
+
+// ========== ROW STORAGE ==========
+
+void FlatGreenhouseTree::Rows::clear() {
+    components.clear();
+    kinds.clear();
+    subtreeEnds.clear();
+    parents.clear();
+    depths.clear();
+    plants.clear();
+    childrenVersions.clear();
+    subtreeVersions.clear();
+}
+
+void FlatGreenhouseTree::Rows::reserve(size_t count) {
+    components.reserve(count);
+    kinds.reserve(count);
+    subtreeEnds.reserve(count);
+    parents.reserve(count);
+    depths.reserve(count);
+    plants.reserve(count);
+    childrenVersions.reserve(count);
+    subtreeVersions.reserve(count);
+}
+
+uint32_t FlatGreenhouseTree::Rows::append(const GreenhouseComponent* component, uint32_t parent,
+                                          uint16_t depth) {
+    uint32_t row = static_cast<uint32_t>(components.size());
+    GreenhouseNodeKind kind = kindOf(component);
+    components.push_back(component);
+    kinds.push_back(kind);
+    subtreeEnds.push_back(row + 1);
+    parents.push_back(parent);
+    depths.push_back(depth);
+    plants.push_back(kind == GreenhouseNodeKind::Plant
+                         ? static_cast<const PlantLeaf*>(component)->getHandle()
+                         : PlantHandle());
+    childrenVersions.push_back(component->getChildrenVersion());
+    subtreeVersions.push_back(component->getSubtreeVersion());
+    return row;
+}
+
+// ========== BUILDING ==========
+
+FlatGreenhouseTree::FlatGreenhouseTree(const GreenhouseComponent* root)
+    : root(root), rowsRebuilt(0) {
+    rebuild();
+}
+
+void FlatGreenhouseTree::setRoot(const GreenhouseComponent* newRoot) {
+    root = newRoot;
+    rebuild();
+}
+
+void FlatGreenhouseTree::rebuild() {
+    rows.clear();
+    if (root) {
+        flatten(root, NONE, 0, rows);
+    }
+    rowsRebuilt = rows.components.size();
+}
+
+void FlatGreenhouseTree::flatten(const GreenhouseComponent* component, uint32_t parent,
+                                 uint16_t depth, Rows& out) {
+    // Explicit stack, so a layout of any depth flattens without growing the call stack
+    struct Pending {
+        const GreenhouseComponent* component;
+        uint32_t parent;
+        uint16_t depth;
+    };
+    const uint32_t first = static_cast<uint32_t>(out.components.size());
+    std::vector<Pending> pending(1, Pending{component, parent, depth});
+    while (!pending.empty()) {
+        const Pending next = pending.back();
+        pending.pop_back();
+        uint32_t row = out.append(next.component, next.parent, next.depth);
+        // Children are pushed last-first so they are appended in order
+        for (int i = next.component->getChildCount(); i-- > 0;) {
+            if (const GreenhouseComponent* child = next.component->getChild(i)) {
+                pending.push_back(Pending{child, row, static_cast<uint16_t>(next.depth + 1)});
+            }
+        }
+    }
+
+    // A subtree ends where its last descendant's does; parents precede their children
+    for (uint32_t row = static_cast<uint32_t>(out.components.size()); row-- > first + 1;) {
+        uint32_t& end = out.subtreeEnds[out.parents[row]];
+        if (out.subtreeEnds[row] > end) {
+            end = out.subtreeEnds[row];
+        }
+    }
+}
+
+bool FlatGreenhouseTree::refresh() {
+    if (isCurrent()) {
+        rowsRebuilt = 0;
+        return false;
+    }
+    if (rows.components.empty() || rows.components[0] != root) {
+        rebuild();
+        return true;
+    }
+    Rows fresh;
+    fresh.reserve(rows.components.size());
+    rowsRebuilt = 0;
+    patch(0, NONE, fresh);
+    rows = std::move(fresh);
+    return true;
+}
+
+void FlatGreenhouseTree::patch(uint32_t row, uint32_t parent, Rows& out) {
+    struct Pending {
+        uint32_t row;       // Row in the old copy
+        uint32_t parent;    // Row of its parent in out
+        uint32_t copy;      // Row in out, once appended (closing frames only)
+        bool closing;
+    };
+    std::vector<Pending> pending(1, Pending{row, parent, NONE, false});
+    std::vector<uint32_t> children;
+    while (!pending.empty()) {
+        const Pending next = pending.back();
+        pending.pop_back();
+        if (next.closing) {
+            out.subtreeEnds[next.copy] = static_cast<uint32_t>(out.components.size());
+            continue;
+        }
+
+        const GreenhouseComponent* component = rows.components[next.row];
+        if (component->getSubtreeVersion() == rows.subtreeVersions[next.row]) {
+            copyBlock(next.row, next.parent, out);
+            continue;
+        }
+        if (component->getChildrenVersion() != rows.childrenVersions[next.row]) {
+            // This node's child list changed - walk its subtree again
+            size_t first = out.components.size();
+            flatten(component, next.parent, rows.depths[next.row], out);
+            rowsRebuilt += out.components.size() - first;
+            continue;
+        }
+
+        // Same children, something changed further down
+        uint32_t copy = out.append(component, next.parent, rows.depths[next.row]);
+        rowsRebuilt++;
+        pending.push_back(Pending{next.row, next.parent, copy, true});
+        children.clear();
+        for (uint32_t child = next.row + 1; child < rows.subtreeEnds[next.row]; child = rows.subtreeEnds[child]) {
+            children.push_back(child);
+        }
+        for (auto it = children.rbegin(); it != children.rend(); ++it) {
+            pending.push_back(Pending{*it, copy, NONE, false});
+        }
+    }
+}
+
+void FlatGreenhouseTree::copyBlock(uint32_t row, uint32_t parent, Rows& out) const {
+    const uint32_t end = rows.subtreeEnds[row];
+    const int64_t shift = static_cast<int64_t>(out.components.size()) - row;
+    for (uint32_t i = row; i < end; i++) {
+        out.components.push_back(rows.components[i]);
+        out.kinds.push_back(rows.kinds[i]);
+        out.subtreeEnds.push_back(static_cast<uint32_t>(rows.subtreeEnds[i] + shift));
+        out.parents.push_back(i == row ? parent : static_cast<uint32_t>(rows.parents[i] + shift));
+        out.depths.push_back(rows.depths[i]);
+        out.plants.push_back(rows.plants[i]);
+        out.childrenVersions.push_back(rows.childrenVersions[i]);
+        out.subtreeVersions.push_back(rows.subtreeVersions[i]);
+    }
+}
+
+bool FlatGreenhouseTree::isCurrent() const {
+    if (!root) {
+        return rows.components.empty();
+    }
+    return !rows.components.empty() && rows.components[0] == root &&
+           rows.subtreeVersions[0] == root->getSubtreeVersion();
+}
+
+size_t FlatGreenhouseTree::getRowsRebuilt() const {
+    return rowsRebuilt;
+}
+
+// ========== ROW ACCESS ==========
+
+size_t FlatGreenhouseTree::size() const {
+    return rows.components.size();
+}
+
+bool FlatGreenhouseTree::isEmpty() const {
+    return rows.components.empty();
+}
+
+GreenhouseNodeKind FlatGreenhouseTree::getKind(size_t row) const {
+    return rows.kinds[row];
+}
+
+const GreenhouseComponent* FlatGreenhouseTree::getComponent(size_t row) const {
+    return rows.components[row];
+}
+
+uint32_t FlatGreenhouseTree::getParent(size_t row) const {
+    return rows.parents[row];
+}
+
+uint16_t FlatGreenhouseTree::getDepth(size_t row) const {
+    return rows.depths[row];
+}
+
+uint32_t FlatGreenhouseTree::getSubtreeEnd(size_t row) const {
+    return rows.subtreeEnds[row];
+}
+
+Plant* FlatGreenhouseTree::getPlant(size_t row) const {
+    return rows.plants[row].get();
+}
+
+PlantHandle FlatGreenhouseTree::getPlantHandle(size_t row) const {
+    return rows.plants[row];
+}
+
+std::vector<uint32_t> FlatGreenhouseTree::childrenOf(size_t row) const {
+    std::vector<uint32_t> result;
+    if (row >= size()) {
+        return result;
+    }
+    for (uint32_t child = static_cast<uint32_t>(row) + 1; child < rows.subtreeEnds[row];
+         child = rows.subtreeEnds[child]) {
+        result.push_back(child);
+    }
+    return result;
+}
+
+std::vector<Plant*> FlatGreenhouseTree::plantsUnder(size_t row) const {
+    std::vector<Plant*> result;
+    forEachPlant(row, [&](Plant* plant) { result.push_back(plant); });
+    return result;
+}
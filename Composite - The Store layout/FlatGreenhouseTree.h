@@ -0,0 +1,143 @@
+#ifndef FLATGREENHOUSETREE_H
+#define FLATGREENHOUSETREE_H
+#include "../Plant - Abstract Base/PlantHandle.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class GreenhouseComponent;
+class Plant;
+
+/**
+ * @brief Kind tag of a node in a FlatGreenhouseTree
+ */
+enum class GreenhouseNodeKind : uint8_t {
+    Greenhouse,
+    Section,
+    Shelf,
+    Plant,
+    Other        // A GreenhouseComponent subclass the tree does not know
+};
+
+/**
+ * @brief Read-optimised, pre-order copy of a composite greenhouse tree
+ *
+ * Every node of the live tree becomes one row of parallel arrays (kind, depth,
+ * parent row, subtree end, component, plant handle). A node's subtree is the
+ * row range [row, getSubtreeEnd(row)), so a walk over thousands of shelves
+ * and plants is a linear scan instead of a virtual-call pointer chase, and a
+ * subtree is skipped with a single jump.
+ *
+ * refresh() brings the copy up to date after the live tree's structure
+ * changes: unchanged subtrees are copied over as row blocks and only nodes
+ * whose child lists changed are walked again. Renames and plant value changes
+ * are not structural; plant handles always resolve to the current plant (or
+ * nullptr once it is destroyed).
+ *
+ * Usage:
+ *   FlatGreenhouseTree flat(greenhouse);
+ *   flat.forEachPlant(0, [](Plant* plant) { ... });
+ *   greenhouse->add(section);
+ *   flat.refresh();
+ */
+class FlatGreenhouseTree {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+private:
+    struct Rows {
+        std::vector<const GreenhouseComponent*> components;
+        std::vector<GreenhouseNodeKind> kinds;
+        std::vector<uint32_t> subtreeEnds;
+        std::vector<uint32_t> parents;
+        std::vector<uint16_t> depths;
+        std::vector<PlantHandle> plants;             // Null except on plant rows
+        std::vector<uint64_t> childrenVersions;      // Component counters when the row was made
+        std::vector<uint64_t> subtreeVersions;
+
+        void clear();
+        void reserve(size_t count);
+        uint32_t append(const GreenhouseComponent* component, uint32_t parent, uint16_t depth);
+    };
+
+    const GreenhouseComponent* root;
+    Rows rows;
+    size_t rowsRebuilt;       // Rows walked from the live tree by the last rebuild/refresh
+
+    void flatten(const GreenhouseComponent* component, uint32_t parent, uint16_t depth, Rows& out);
+    void patch(uint32_t row, uint32_t parent, Rows& out);
+    void copyBlock(uint32_t row, uint32_t parent, Rows& out) const;
+
+public:
+    explicit FlatGreenhouseTree(const GreenhouseComponent* root = nullptr);
+
+    /**
+     * @brief Flatten a different tree (nullptr for an empty tree)
+     */
+    void setRoot(const GreenhouseComponent* newRoot);
+
+    /**
+     * @brief Flatten the whole live tree again
+     */
+    void rebuild();
+
+    /**
+     * @brief Patch the copy to match the live tree's current structure
+     *
+     * Removed components must still be alive when this is called if they
+     * were removed from a node that has not been refreshed since; components
+     * are only read through rows whose parent's child list is unchanged.
+     *
+     * @return false if nothing had changed
+     */
+    bool refresh();
+
+    /**
+     * @brief Whether the live tree is unchanged since the last rebuild or refresh
+     */
+    bool isCurrent() const;
+
+    /**
+     * @brief Rows re-read from the live tree by the last rebuild or refresh
+     */
+    size_t getRowsRebuilt() const;
+
+    size_t size() const;
+    bool isEmpty() const;
+
+    // ========== ROW ACCESS ==========
+    GreenhouseNodeKind getKind(size_t row) const;
+    const GreenhouseComponent* getComponent(size_t row) const;
+    uint32_t getParent(size_t row) const;          // NONE for the root
+    uint16_t getDepth(size_t row) const;
+    uint32_t getSubtreeEnd(size_t row) const;      // One past the last descendant
+    Plant* getPlant(size_t row) const;             // nullptr unless a live plant row
+    PlantHandle getPlantHandle(size_t row) const;
+
+    /**
+     * @brief Rows of a node's direct children
+     */
+    std::vector<uint32_t> childrenOf(size_t row) const;
+
+    /**
+     * @brief Call visit(plant) for every live plant in a node's subtree, in tree order
+     */
+    template <typename Visitor>
+    void forEachPlant(size_t row, Visitor visit) const {
+        const size_t end = row < size() ? rows.subtreeEnds[row] : row;
+        for (size_t i = row; i < end; i++) {
+            if (rows.kinds[i] == GreenhouseNodeKind::Plant) {
+                if (Plant* plant = rows.plants[i].get()) {
+                    visit(plant);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Live plants in a node's subtree, in tree order
+     */
+    std::vector<Plant*> plantsUnder(size_t row) const;
+};
+
+#endif // FLATGREENHOUSETREE_H
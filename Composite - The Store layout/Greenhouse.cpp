@@ -1,8 +1,41 @@
 #include "Greenhouse.h"
-#include <iostream>
+#include "Shelf.h"
+#include "PlantLeaf.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace {
+    // A shelf's segment carries its number, so sibling shelves sharing a name stay apart
+    std::string pathSegment(const GreenhouseComponent* node, const Shelf* shelf) {
+        return shelf ? node->getName() + " " + std::to_string(shelf->getShelfNumber()) : node->getName();
+    }
+
+    // Drop one node from the list filed under key, and the key once its list is empty
+    template <typename Table, typename Key, typename Node>
+    void unfile(Table& table, const Key& key, Node* node) {
+        auto it = table.find(key);
+        if (it == table.end()) {
+            return;
+        }
+        auto& nodes = it->second;
+        for (size_t i = nodes.size(); i-- > 0;) {
+            if (nodes[i] == node) {
+                nodes.erase(nodes.begin() + static_cast<std::ptrdiff_t>(i));
+                break;
+            }
+        }
+        if (nodes.empty()) {
+            table.erase(it);
+        }
+    }
+}
 
 Greenhouse::Greenhouse(const std::string& name)
     : GreenhouseComponent(name), controller(nullptr) {
+    byPath[name].push_back(this);
+    layoutChanged();
 }
 
 Greenhouse::~Greenhouse() {
@@ -11,18 +44,15 @@ Greenhouse::~Greenhouse() {
     controller = nullptr;
 }
 
-void Greenhouse::display(int depth) const {
-    std::string indent(depth * 2, ' ');
-    std::cout << indent << "=== GREENHOUSE: " << getName() << " ===" << std::endl;
-    
-    // Display all children (sections)
-    for (const auto& child : children) {
-        if (child) {
-            child->display(depth + 1);
-        }
-    }
-    
-    std::cout << indent << "=== END OF GREENHOUSE ===" << std::endl;
+void Greenhouse::describe(std::string& line) const {
+    line += "=== GREENHOUSE: ";
+    line += name;
+    line += " ===";
+}
+
+bool Greenhouse::describeEnd(std::string& line) const {
+    line += "=== END OF GREENHOUSE ===";
+    return true;
 }
 
 void Greenhouse::setController(GreenhouseController* ctrl) {
@@ -36,3 +66,120 @@ GreenhouseController* Greenhouse::getController() const {
 bool Greenhouse::isComposite() const {
     return true;
 }
+
+// ========== LOOKUP ==========
+
+void Greenhouse::subtreeAttached(GreenhouseComponent* subtree) {
+    indexSubtree(subtree, true);
+}
+
+void Greenhouse::subtreeDetached(GreenhouseComponent* subtree) {
+    indexSubtree(subtree, false);
+}
+
+void Greenhouse::indexSubtree(GreenhouseComponent* subtree, bool attach) {
+    FlatGreenhouseTree scratch;
+    uint32_t first = 0;
+    const FlatGreenhouseTree& rows = subtree->layoutRows(scratch, first);
+    const uint32_t end = rows.getSubtreeEnd(first);
+    const int top = rows.getDepth(first);
+
+    // Path and shelf number of each open ancestor, by depth below the subtree's parent
+    struct Place {
+        std::string path;
+        int shelfNumber;   // 0 unless the ancestor is a shelf
+    };
+    const Shelf* parentShelf = dynamic_cast<const Shelf*>(subtree->getParent());
+    std::vector<Place> places(1, Place{pathOf(subtree->getParent()), parentShelf ? parentShelf->getShelfNumber() : 0});
+
+    for (uint32_t row = first; row < end; row++) {
+        const size_t level = static_cast<size_t>(rows.getDepth(row) - top);
+        const GreenhouseNodeKind kind = rows.getKind(row);
+
+        if (kind == GreenhouseNodeKind::Plant) {
+            if (Plant* plant = rows.getPlant(row)) {
+                plant->setLocation(attach ? places[level].path : "");
+                plant->setShelfNumber(attach ? places[level].shelfNumber : 0);
+            }
+            continue;
+        }
+
+        GreenhouseComponent* node = const_cast<GreenhouseComponent*>(rows.getComponent(row));
+        Shelf* shelf = kind == GreenhouseNodeKind::Shelf ? static_cast<Shelf*>(node) : nullptr;
+        std::string path = places[level].path + "/" + pathSegment(node, shelf);
+        if (attach) {
+            byPath[path].push_back(node);
+            if (shelf) {
+                byShelfNumber[shelf->getShelfNumber()].push_back(shelf);
+            }
+        } else {
+            unfile(byPath, path, node);
+            if (shelf) {
+                unfile(byShelfNumber, shelf->getShelfNumber(), shelf);
+            }
+        }
+        places.resize(level + 1);
+        places.push_back(Place{std::move(path), shelf ? shelf->getShelfNumber() : 0});
+    }
+}
+
+const FlatGreenhouseTree* Greenhouse::getLayout() const {
+    return layout.isCurrent() ? &layout : nullptr;
+}
+
+void Greenhouse::layoutChanged() {
+    if (getParent()) {
+        return;   // Nested: the root's layout covers this tree
+    }
+    if (layout.isEmpty()) {
+        layout.setRoot(this);
+    } else {
+        layout.refresh();
+    }
+    for (size_t row = 0; row < layout.size(); row++) {
+        layout.getComponent(row)->layoutRow = static_cast<uint32_t>(row);
+    }
+}
+
+std::string Greenhouse::pathOf(const GreenhouseComponent* component) const {
+    std::vector<const GreenhouseComponent*> chain;
+    for (const GreenhouseComponent* node = component; node; node = node->getParent()) {
+        chain.push_back(node);
+        if (node == this) {
+            break;
+        }
+    }
+    if (chain.empty() || chain.back() != this) {
+        return "";
+    }
+    std::string path = getName();
+    for (size_t i = chain.size() - 1; i-- > 0;) {
+        path += "/";
+        path += pathSegment(chain[i], dynamic_cast<const Shelf*>(chain[i]));
+    }
+    return path;
+}
+
+GreenhouseComponent* Greenhouse::findByPath(const std::string& path) const {
+    auto it = byPath.find(path);
+    return it == byPath.end() ? nullptr : it->second.back();
+}
+
+Shelf* Greenhouse::findShelf(int number) const {
+    auto it = byShelfNumber.find(number);
+    return it == byShelfNumber.end() ? nullptr : it->second.back();
+}
+
+bool Greenhouse::relocatePlant(Plant* plant, int shelfNumber) {
+    PlantLeaf* leaf = plant ? plant->getLeaf() : nullptr;
+    Shelf* target = findShelf(shelfNumber);
+    if (!leaf || !target || pathOf(leaf).empty()) {
+        return false;
+    }
+    GreenhouseComponent* from = leaf->getParent();
+    if (from != target) {
+        from->remove(leaf);
+        target->add(leaf);
+    }
+    return true;
+}
@@ -1,21 +1,83 @@
 #ifndef GREENHOUSE_H
 #define GREENHOUSE_H
 #include "GreenhouseComponent.h"
+#include "FlatGreenhouseTree.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 class GreenhouseController;
+class Plant;
+
+/**
+ * @brief Root of a greenhouse layout
+ *
+ * Keeps two lookup tables over everything below it, maintained by add() and
+ * remove() anywhere in the tree: composite nodes by path ("Main Greenhouse/
+ * Desert Section/Shelf 4", names joined with '/', each shelf's name followed
+ * by its number) and shelves by number. If two nodes share a path or shelf
+ * number, the one added last is found; once it is removed, the other is
+ * found again.
+ *
+ * Attaching a PlantLeaf also records its position on the plant
+ * (Plant::setLocation() gets the parent's path, Plant::setShelfNumber() the
+ * shelf's number), so a plant's place in the layout is never free-form.
+ *
+ * A greenhouse that is the root of its tree also keeps a FlatGreenhouseTree
+ * of it, refreshed on every add() or remove() below, which bulk walks
+ * (display, aggregates, the lookup tables, parallel visits) scan as row
+ * ranges. Each structural change costs a pass over the rows, so large
+ * subtrees are best assembled before they are attached.
+ */
 
 class Greenhouse : public GreenhouseComponent {
 private:
     GreenhouseController* controller;
+    // Every node filed under a key, oldest first; lookups return the newest
+    std::unordered_map<std::string, std::vector<GreenhouseComponent*>> byPath;
+    std::unordered_map<int, std::vector<Shelf*>> byShelfNumber;
+    FlatGreenhouseTree layout;                   // This tree, while the greenhouse is its root
+
+    void indexSubtree(GreenhouseComponent* subtree, bool attach);
+
+protected:
+    void describe(std::string& line) const override;
+    bool describeEnd(std::string& line) const override;
+    void subtreeAttached(GreenhouseComponent* subtree) override;
+    void subtreeDetached(GreenhouseComponent* subtree) override;
+    const FlatGreenhouseTree* getLayout() const override;
+    void layoutChanged() override;
     
 public:
     Greenhouse(const std::string& name = "Main Greenhouse");
     virtual ~Greenhouse();
     
-    void display(int depth = 0) const override;
     void setController(GreenhouseController* ctrl);
     GreenhouseController* getController() const;
     bool isComposite() const override;
+
+    // ========== LOOKUP ==========
+
+    /**
+     * @brief Path of a component below (or equal to) this greenhouse, or "" if it is not in it
+     */
+    std::string pathOf(const GreenhouseComponent* component) const;
+
+    /**
+     * @brief Composite node at a path, or nullptr
+     */
+    GreenhouseComponent* findByPath(const std::string& path) const;
+
+    /**
+     * @brief Shelf with a number, or nullptr
+     */
+    Shelf* findShelf(int number) const;
+
+    /**
+     * @brief Move a plant's leaf to another shelf
+     * @return false if the plant has no leaf in this greenhouse or the shelf does not exist
+     */
+    bool relocatePlant(Plant* plant, int shelfNumber);
 };
 
 #endif // GREENHOUSE_H
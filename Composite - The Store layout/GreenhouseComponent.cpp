@@ -1,8 +1,16 @@
 #include "GreenhouseComponent.h"
+#include "FlatGreenhouseTree.h"
+#include "../Plant - Abstract Base/Plant.h"
 #include <algorithm>
+#include <iostream>
+
+namespace {
+    thread_local std::string displayBuffer;   // Keeps its capacity between display() calls
+}
 
 GreenhouseComponent::GreenhouseComponent(const std::string& componentName)
-    : name(componentName) {
+    : name(componentName), parent(nullptr), childrenVersion(0), subtreeVersion(0),
+      aggregatesDirty(true), layoutRow(FlatGreenhouseTree::NONE) {
 }
 
 GreenhouseComponent::~GreenhouseComponent() {
@@ -16,13 +24,114 @@ GreenhouseComponent::~GreenhouseComponent() {
 void GreenhouseComponent::add(GreenhouseComponent* component) {
     if (component) {
         children.push_back(component);
+        component->parent = this;
+        structureChanged();   // First, so the hooks see the new subtree in the layout
+        for (GreenhouseComponent* node = this; node; node = node->parent) {
+            node->subtreeAttached(component);
+        }
     }
 }
 
 void GreenhouseComponent::remove(GreenhouseComponent* component) {
     auto it = std::find(children.begin(), children.end(), component);
     if (it != children.end()) {
+        for (GreenhouseComponent* node = this; node; node = node->parent) {
+            node->subtreeDetached(component);
+        }
         children.erase(it);
+        if (component->parent == this) {
+            component->parent = nullptr;
+        }
+        structureChanged();
+        if (!component->parent) {
+            component->layoutChanged();   // Now a root of its own
+        }
+    }
+}
+
+void GreenhouseComponent::structureChanged() {
+    childrenVersion++;
+    GreenhouseComponent* root = this;
+    for (GreenhouseComponent* node = this; node; node = node->parent) {
+        node->subtreeVersion++;
+        root = node;
+    }
+    invalidateAggregates();
+    root->layoutChanged();
+}
+
+const FlatGreenhouseTree* GreenhouseComponent::getLayout() const {
+    return nullptr;
+}
+
+void GreenhouseComponent::layoutChanged() {
+    // Only roots that keep a layout (Greenhouse) react
+}
+
+const FlatGreenhouseTree& GreenhouseComponent::layoutRows(FlatGreenhouseTree& scratch, uint32_t& row) const {
+    const GreenhouseComponent* root = this;
+    while (root->parent) {
+        root = root->parent;
+    }
+    const FlatGreenhouseTree* layout = root->getLayout();
+    if (layout && layoutRow < layout->size() && layout->getComponent(layoutRow) == this) {
+        row = layoutRow;
+        return *layout;
+    }
+    scratch.setRoot(this);
+    row = 0;
+    return scratch;
+}
+
+// ========== DISPLAY ==========
+
+void GreenhouseComponent::describe(std::string& line) const {
+    line += name;
+}
+
+bool GreenhouseComponent::describeEnd(std::string&) const {
+    return false;
+}
+
+void GreenhouseComponent::display(int depth) const {
+    displayBuffer.clear();
+    render(displayBuffer, depth);
+    std::cout.write(displayBuffer.data(), static_cast<std::streamsize>(displayBuffer.size()));
+    std::cout.flush();
+}
+
+void GreenhouseComponent::render(std::string& out, int depth) const {
+    FlatGreenhouseTree scratch;
+    uint32_t first = 0;
+    const FlatGreenhouseTree& rows = layoutRows(scratch, first);
+    const uint32_t end = rows.getSubtreeEnd(first);
+    const int base = (depth > 0 ? depth : 0) - rows.getDepth(first);
+
+    // Rows whose end line is still to come, innermost last
+    std::vector<uint32_t> open;
+    auto close = [&](uint32_t row) {
+        const size_t lineStart = out.size();
+        out.append(static_cast<size_t>(base + rows.getDepth(row)) * 2, ' ');
+        if (rows.getComponent(row)->describeEnd(out)) {
+            out += '\n';
+        } else {
+            out.resize(lineStart);
+        }
+    };
+
+    for (uint32_t row = first; row < end; row++) {
+        while (!open.empty() && rows.getSubtreeEnd(open.back()) <= row) {
+            close(open.back());
+            open.pop_back();
+        }
+        out.append(static_cast<size_t>(base + rows.getDepth(row)) * 2, ' ');
+        rows.getComponent(row)->describe(out);
+        out += '\n';
+        open.push_back(row);
+    }
+    while (!open.empty()) {
+        close(open.back());
+        open.pop_back();
     }
 }
 
@@ -44,3 +153,89 @@ std::string GreenhouseComponent::getName() const {
 bool GreenhouseComponent::isComposite() const {
     return true;  // Default implementation for composites
 }
+
+GreenhouseComponent* GreenhouseComponent::getParent() const {
+    return parent;
+}
+
+uint64_t GreenhouseComponent::getChildrenVersion() const {
+    return childrenVersion;
+}
+
+uint64_t GreenhouseComponent::getSubtreeVersion() const {
+    return subtreeVersion;
+}
+
+void GreenhouseComponent::subtreeAttached(GreenhouseComponent*) {
+    // Only nodes that index their subtree (Greenhouse) react
+}
+
+void GreenhouseComponent::subtreeDetached(GreenhouseComponent*) {
+}
+
+// ========== CACHED AGGREGATES ==========
+
+SubtreeAggregates GreenhouseComponent::computeAggregates() const {
+    return SubtreeAggregates();
+}
+
+void GreenhouseComponent::updateAggregates(const FlatGreenhouseTree& layout, uint32_t row) {
+    // Post-order over the rows, descending only into dirty subtrees
+    struct Pending {
+        uint32_t row;
+        bool merge;   // Children are up to date; merge their totals into this row's
+    };
+    std::vector<Pending> pending(1, Pending{row, false});
+    while (!pending.empty()) {
+        const Pending next = pending.back();
+        pending.pop_back();
+        const GreenhouseComponent* node = layout.getComponent(next.row);
+        const uint32_t end = layout.getSubtreeEnd(next.row);
+
+        if (next.merge) {
+            SubtreeAggregates total;
+            for (uint32_t child = next.row + 1; child < end; child = layout.getSubtreeEnd(child)) {
+                total.merge(layout.getComponent(child)->aggregates);
+            }
+            node->aggregates = total;
+            node->aggregatesDirty = false;
+            continue;
+        }
+        if (!node->aggregatesDirty) {
+            continue;
+        }
+        if (layout.getKind(next.row) == GreenhouseNodeKind::Plant) {
+            SubtreeAggregates total;
+            if (Plant* plant = layout.getPlant(next.row)) {
+                total.addPlant(plant->getBasePrice(), plant->getHealthLevel(), plant->isReadyForSale());
+            }
+            node->aggregates = total;
+            node->aggregatesDirty = false;
+        } else if (end == next.row + 1) {
+            node->aggregates = node->computeAggregates();
+            node->aggregatesDirty = false;
+        } else {
+            pending.push_back(Pending{next.row, true});
+            for (uint32_t child = next.row + 1; child < end; child = layout.getSubtreeEnd(child)) {
+                pending.push_back(Pending{child, false});
+            }
+        }
+    }
+}
+
+const SubtreeAggregates& GreenhouseComponent::getAggregates() const {
+    if (aggregatesDirty) {
+        FlatGreenhouseTree scratch;
+        uint32_t row = 0;
+        const FlatGreenhouseTree& layout = layoutRows(scratch, row);
+        updateAggregates(layout, row);
+    }
+    return aggregates;
+}
+
+void GreenhouseComponent::invalidateAggregates() {
+    // A dirty node's ancestors are always dirty, so the walk can stop early
+    for (GreenhouseComponent* node = this; node && !node->aggregatesDirty; node = node->parent) {
+        node->aggregatesDirty = true;
+    }
+}
@@ -1,8 +1,11 @@
 #ifndef GREENHOUSECOMPONENT_H
 #define GREENHOUSECOMPONENT_H
+#include "SubtreeAggregates.h"
+#include <cstdint>
 #include <vector>
 #include <string>
 
+class FlatGreenhouseTree;
 class InventoryManager;
 class Shelf;
 class Greenhouse;
@@ -12,18 +15,118 @@ class GreenhouseComponent {
 protected:
     std::vector<GreenhouseComponent*> children;  // Composite children
     std::string name;
+
+private:
+    GreenhouseComponent* parent;                 // Set by add(), cleared by remove()
+    uint64_t childrenVersion;                    // Bumped when this node's child list changes
+    uint64_t subtreeVersion;                     // Bumped when any child list below (or at) this node changes
+    mutable SubtreeAggregates aggregates;        // Cached totals of this subtree
+    mutable bool aggregatesDirty;                // Set on this node and all its ancestors by invalidateAggregates()
+    mutable uint32_t layoutRow;                  // Row in the root Greenhouse's layout (set when it is refreshed)
+
+    friend class Greenhouse;
+
+    void structureChanged();
+    static void updateAggregates(const FlatGreenhouseTree& layout, uint32_t row);
+
+protected:
+    /**
+     * @brief Totals of a node without children (composite totals are merged from the children's rows)
+     */
+    virtual SubtreeAggregates computeAggregates() const;
+
+    /**
+     * @brief Current flat copy of the tree rooted here, or nullptr if this node keeps none
+     */
+    virtual const FlatGreenhouseTree* getLayout() const;
+
+    /**
+     * @brief The structure below this node changed (called on the root after every add()/remove())
+     */
+    virtual void layoutChanged();
+
+    /**
+     * @brief Append this node's display line, without indentation or newline
+     */
+    virtual void describe(std::string& line) const;
+
+    /**
+     * @brief Append the line closing this node's block, if it has one
+     * @return false if nothing was appended (the default)
+     */
+    virtual bool describeEnd(std::string& line) const;
+
+    /**
+     * @brief A subtree was added below this node (called on every ancestor of the new parent)
+     */
+    virtual void subtreeAttached(GreenhouseComponent* subtree);
+
+    /**
+     * @brief A subtree is about to be removed from below this node (still linked when called)
+     */
+    virtual void subtreeDetached(GreenhouseComponent* subtree);
     
 public:
     GreenhouseComponent(const std::string& componentName = "");
     virtual ~GreenhouseComponent();
     
-    virtual void display(int depth = 0) const = 0;
+    /**
+     * @brief Print this subtree to std::cout, indented two spaces per level
+     *
+     * The layout is rendered into a reused per-thread buffer and written in a
+     * single call; nodes contribute their lines through describe() and
+     * describeEnd().
+     */
+    virtual void display(int depth = 0) const;
+
+    /**
+     * @brief Append the text display() prints for this subtree
+     *
+     * Scans the subtree's rows of the flat layout (see layoutRows()), so any
+     * depth of layout renders without recursion.
+     */
+    void render(std::string& out, int depth = 0) const;
+
     virtual void add(GreenhouseComponent* component);
     virtual void remove(GreenhouseComponent* component);
     virtual GreenhouseComponent* getChild(int index) const;
     virtual int getChildCount() const;
     std::string getName() const;
     virtual bool isComposite() const;
+
+    GreenhouseComponent* getParent() const;
+
+    /**
+     * @brief Rows of this subtree for a bulk traversal: [row, getSubtreeEnd(row)) of the returned tree
+     *
+     * Below a Greenhouse root this is the greenhouse's own layout, kept
+     * current on every add()/remove(), and reading it has no side effects.
+     * Elsewhere the subtree is flattened into scratch (row 0).
+     */
+    const FlatGreenhouseTree& layoutRows(FlatGreenhouseTree& scratch, uint32_t& row) const;
+
+    /**
+     * @brief Change counters used by FlatGreenhouseTree to patch only what changed
+     */
+    uint64_t getChildrenVersion() const;
+    uint64_t getSubtreeVersion() const;
+
+    /**
+     * @brief Plant count, ready count, stock value and minimum health of this subtree
+     *
+     * Cached per node: O(1) while nothing below has changed, otherwise only
+     * the dirty nodes on the changed paths are recomputed, bottom-up over the
+     * layout rows.
+     */
+    const SubtreeAggregates& getAggregates() const;
+
+    /**
+     * @brief Mark this node's totals and those of its ancestors as stale
+     *
+     * Called by add()/remove() and, through PlantLeafIndex, whenever a plant
+     * on a leaf changes. Stops at the first ancestor that is already stale.
+     */
+    void invalidateAggregates();
 };
 
 #endif // GREENHOUSECOMPONENT_H
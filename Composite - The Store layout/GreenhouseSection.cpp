@@ -1,5 +1,4 @@
 #include "GreenhouseSection.h"
-#include <iostream>
 
 GreenhouseSection::GreenhouseSection(const std::string& type, const std::string& name)
     : GreenhouseComponent(name), sectionType(type) {
@@ -9,16 +8,12 @@ GreenhouseSection::~GreenhouseSection() {
     // Base class destructor will handle children
 }
 
-void GreenhouseSection::display(int depth) const {
-    std::string indent(depth * 2, ' ');
-    std::cout << indent << "++ Section: " << getName() << " (" << sectionType << ")" << std::endl;
-    
-    // Display all children (shelves and subsections)
-    for (const auto& child : children) {
-        if (child) {
-            child->display(depth + 1);
-        }
-    }
+void GreenhouseSection::describe(std::string& line) const {
+    line += "++ Section: ";
+    line += name;
+    line += " (";
+    line += sectionType;
+    line += ')';
 }
 
 std::string GreenhouseSection::getSectionType() const {
@@ -5,12 +5,14 @@
 class GreenhouseSection : public GreenhouseComponent {
 private:
     std::string sectionType;
+
+protected:
+    void describe(std::string& line) const override;
     
 public:
     GreenhouseSection(const std::string& type, const std::string& name = "Section");
     virtual ~GreenhouseSection();
     
-    void display(int depth = 0) const override;
     std::string getSectionType() const;
     bool isComposite() const override;
 };
@@ -0,0 +1,21 @@
+#include "ParallelGreenhouseVisitor.h"
+
+namespace {
+    const size_t PIECES_PER_THREAD = 8;   // Spare pieces for idle threads to steal
+}
+
+ParallelGreenhouseVisitor::ParallelGreenhouseVisitor(WorkStealingPool& workPool, size_t minimumGrain)
+    : pool(workPool), minGrain(minimumGrain == 0 ? 1 : minimumGrain) {}
+
+size_t ParallelGreenhouseVisitor::grainFor(size_t rows) const {
+    const size_t grain = rows / (PIECES_PER_THREAD * pool.getConcurrency());
+    return grain < minGrain ? minGrain : grain;
+}
+
+size_t ParallelGreenhouseVisitor::getMinGrain() const {
+    return minGrain;
+}
+
+WorkStealingPool& ParallelGreenhouseVisitor::getPool() const {
+    return pool;
+}
@@ -0,0 +1,235 @@
+#ifndef PARALLELGREENHOUSEVISITOR_H
+#define PARALLELGREENHOUSEVISITOR_H
+#include "GreenhouseComponent.h"
+#include "FlatGreenhouseTree.h"
+#include "../Core - Simulation Services/WorkStealingPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+#include <vector>
+
+class Plant;
+
+/**
+ * @brief Fork-join reduction over every leaf of a greenhouse subtree
+ *
+ * The subtree is read as its row range of the flat layout (see
+ * GreenhouseComponent::layoutRows()), and the range is split in halves on a
+ * WorkStealingPool until a half is no larger than the grain; each piece is
+ * then scanned sequentially into its own partial result. Splitting by rows
+ * rather than by children spreads a 10M-plant shelf over the pool as well as
+ * a greenhouse of many small ones, with a fork depth of log(rows / grain).
+ * Plant reductions read plants straight from the layout's handle column.
+ *
+ * The grain is the larger of the minimum grain and rows / (8 * concurrency),
+ * giving each thread several pieces to balance with. Below a Greenhouse root
+ * the layout is already current; any other subtree is flattened on the
+ * calling thread first.
+ *
+ * Partial results are combined in tree order, so the outcome is the same as
+ * a sequential pre-order walk (collect() returns plants in layout order)
+ * regardless of how the work was scheduled. The tree must not be modified
+ * while a traversal runs, and visitors run concurrently: they should only
+ * write their own accumulator. Plant setters notify PlantStore observers,
+ * which are not thread-safe, so a pass that changes plants collects them
+ * here and applies the change afterwards. If a visitor or combine throws,
+ * the traversal waits for every running piece and rethrows the exception on
+ * the calling thread.
+ *
+ * Usage:
+ *   ParallelGreenhouseVisitor parallel;
+ *   double stock = parallel.sum(greenhouse, [](const Plant* p) { return p->getBasePrice(); });
+ *   std::vector<Plant*> thirsty = parallel.collect(greenhouse,
+ *       [](const Plant* p) { return p->needsWater(); });
+ */
+class ParallelGreenhouseVisitor {
+private:
+    WorkStealingPool& pool;
+    size_t minGrain;
+
+    size_t grainFor(size_t rows) const;
+
+    /**
+     * @brief Fold rows [begin, end) with visit(acc, rows, row), forking the first half and joining in tree order
+     */
+    template <typename Result, typename RowVisit, typename Combine>
+    Result reduceRange(const FlatGreenhouseTree& rows, uint32_t begin, uint32_t end, size_t grain,
+                       const Result& identity, RowVisit& visit, Combine& combine) const {
+        if (end - begin <= grain) {
+            Result acc = identity;
+            for (uint32_t row = begin; row < end; row++) {
+                visit(acc, rows, row);
+            }
+            return acc;
+        }
+
+        const uint32_t mid = begin + (end - begin) / 2;
+        Result left = identity;
+        WorkStealingPool::TaskGroup group;
+        pool.spawn(group, [&]() {
+            left = reduceRange(rows, begin, mid, grain, identity, visit, combine);
+        });
+
+        // The spawned half refers to left and group: join it before any unwinding
+        Result right = identity;
+        std::exception_ptr failure;
+        try {
+            right = reduceRange(rows, mid, end, grain, identity, visit, combine);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+        pool.wait(group);   // Rethrows a failure of the spawned half
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        combine(left, right);
+        return left;
+    }
+
+    /**
+     * @brief Fold every row of root's subtree with visit(acc, rows, row)
+     */
+    template <typename Result, typename RowVisit, typename Combine>
+    Result reduceRows(const GreenhouseComponent* root, const Result& identity, RowVisit visit,
+                      Combine& combine) const {
+        if (!root) {
+            return identity;
+        }
+        FlatGreenhouseTree scratch;
+        uint32_t first = 0;
+        const FlatGreenhouseTree& rows = root->layoutRows(scratch, first);
+        const uint32_t end = rows.getSubtreeEnd(first);
+        return reduceRange(rows, first, end, grainFor(end - first), identity, visit, combine);
+    }
+
+    /**
+     * @brief Fold every live plant below root with visit(acc, plant)
+     */
+    template <typename Result, typename PlantVisit, typename Combine>
+    Result reducePlants(const GreenhouseComponent* root, const Result& identity, PlantVisit& visit,
+                        Combine combine) const {
+        return reduceRows(root, identity,
+                          [&visit](Result& acc, const FlatGreenhouseTree& rows, uint32_t row) {
+                              if (rows.getKind(row) == GreenhouseNodeKind::Plant) {
+                                  if (Plant* plant = rows.getPlant(row)) {
+                                      visit(acc, plant);
+                                  }
+                              }
+                          },
+                          combine);
+    }
+
+public:
+    static constexpr size_t DEFAULT_MIN_GRAIN = 2048;
+
+    /**
+     * @param workPool Pool the traversal runs on
+     * @param minimumGrain Fewest layout rows (about one per plant) worth handing to a task of their own
+     */
+    explicit ParallelGreenhouseVisitor(WorkStealingPool& workPool = WorkStealingPool::shared(),
+                                       size_t minimumGrain = DEFAULT_MIN_GRAIN);
+
+    /**
+     * @brief Fold every leaf below root into one result
+     *
+     * @param identity Starting value of every partial result
+     * @param visit void(Result& acc, const GreenhouseComponent* leaf), called once per leaf
+     * @param combine void(Result& left, Result& right), folds right (later in the tree) into left
+     */
+    template <typename Result, typename Visit, typename Combine>
+    Result reduce(const GreenhouseComponent* root, const Result& identity, Visit visit, Combine combine) const {
+        return reduceRows(root, identity,
+                          [&visit](Result& acc, const FlatGreenhouseTree& rows, uint32_t row) {
+                              const GreenhouseNodeKind kind = rows.getKind(row);
+                              const bool leaf = kind == GreenhouseNodeKind::Plant ||
+                                                (kind == GreenhouseNodeKind::Other &&
+                                                 !rows.getComponent(row)->isComposite());
+                              if (leaf) {
+                                  visit(acc, rows.getComponent(row));
+                              }
+                          },
+                          combine);
+    }
+
+    // ========== PLANT REDUCTIONS ==========
+
+    /**
+     * @brief Call f(Plant*) for every plant below root, concurrently
+     */
+    template <typename Function>
+    void forEachPlant(const GreenhouseComponent* root, Function f) const {
+        struct Nothing {};
+        auto visit = [&f](Nothing&, Plant* plant) { f(plant); };
+        reducePlants(root, Nothing(), visit, [](Nothing&, Nothing&) {});
+    }
+
+    /**
+     * @brief Sum of value(const Plant*) over every plant below root
+     */
+    template <typename Value>
+    double sum(const GreenhouseComponent* root, Value value) const {
+        auto visit = [&value](double& acc, Plant* plant) { acc += value(plant); };
+        return reducePlants(root, 0.0, visit, [](double& left, double& right) { left += right; });
+    }
+
+    /**
+     * @brief Plant with the smallest value(const Plant*) (first in layout order on ties), or nullptr
+     */
+    template <typename Value>
+    Plant* minPlant(const GreenhouseComponent* root, Value value) const {
+        return extreme(root, value, false);
+    }
+
+    /**
+     * @brief Plant with the largest value(const Plant*) (first in layout order on ties), or nullptr
+     */
+    template <typename Value>
+    Plant* maxPlant(const GreenhouseComponent* root, Value value) const {
+        return extreme(root, value, true);
+    }
+
+    /**
+     * @brief Plants below root matching predicate(const Plant*), in layout order
+     */
+    template <typename Predicate>
+    std::vector<Plant*> collect(const GreenhouseComponent* root, Predicate predicate) const {
+        auto visit = [&predicate](std::vector<Plant*>& acc, Plant* plant) {
+            if (predicate(plant)) {
+                acc.push_back(plant);
+            }
+        };
+        return reducePlants(root, std::vector<Plant*>(), visit,
+                            [](std::vector<Plant*>& left, std::vector<Plant*>& right) {
+                                if (left.empty()) {
+                                    left.swap(right);
+                                } else {
+                                    left.insert(left.end(), right.begin(), right.end());
+                                }
+                            });
+    }
+
+    size_t getMinGrain() const;
+    WorkStealingPool& getPool() const;
+
+private:
+    template <typename Value>
+    Plant* extreme(const GreenhouseComponent* root, Value& value, bool largest) const {
+        typedef std::pair<Plant*, double> Best;
+        auto visit = [&value, largest](Best& best, Plant* plant) {
+            double v = value(plant);
+            if (!best.first || (largest ? v > best.second : v < best.second)) {
+                best = Best(plant, v);
+            }
+        };
+        return reducePlants(root, Best(nullptr, 0.0), visit,
+                            [largest](Best& left, Best& right) {
+                                if (right.first && (!left.first || (largest ? right.second > left.second
+                                                                            : right.second < left.second))) {
+                                    left = right;
+                                }
+                            }).first;
+    }
+};
+
+#endif // PARALLELGREENHOUSEVISITOR_H
@@ -1,34 +1,58 @@
 #include "PlantLeaf.h"
+#include "PlantLeafIndex.h"
 #include "../Plant - Abstract Base/Plant.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 #include <string>
 
 PlantLeaf::PlantLeaf(Plant* p, const std::string& name)
-    : GreenhouseComponent(name), plant(p) {
+    : GreenhouseComponent(name), plant(p), index(nullptr), indexedPlant(nullptr),
+      prevLeafOfPlant(nullptr), nextLeafOfPlant(nullptr) {
+    if (p) {
+        PlantLeafIndex::forStore(p->getStore()).link(this, p);
+    }
 }
 
 PlantLeaf::~PlantLeaf() {
     // We don't own the plant, just reference it
-    plant = nullptr;
+    if (index) {
+        index->unlink(this);
+    }
 }
 
-void PlantLeaf::display(int depth) const {
-    std::string indent(depth * 2, ' ');
-    std::cout << indent << "- " << getName() << " (Leaf)" << std::endl;
+void PlantLeaf::describe(std::string& line) const {
+    line += "- ";
+    line += name;
+    line += " (Leaf)";
 }
 
 Plant* PlantLeaf::getPlant() const {
+    return plant.get();
+}
+
+PlantHandle PlantLeaf::getHandle() const {
     return plant;
 }
 
+PlantLeaf* PlantLeaf::getNextLeafOfPlant() const {
+    return nextLeafOfPlant;
+}
+
+SubtreeAggregates PlantLeaf::computeAggregates() const {
+    SubtreeAggregates total;
+    if (Plant* p = plant.get()) {
+        total.addPlant(p->getBasePrice(), p->getHealthLevel(), p->isReadyForSale());
+    }
+    return total;
+}
+
 void PlantLeaf::add(GreenhouseComponent* component) {
     // Leaf cannot have children - do nothing
-    std::cout << "Cannot add to a leaf node." << std::endl;
+    LOG_WARN("Cannot add to a leaf node.");
 }
 
 void PlantLeaf::remove(GreenhouseComponent* component) {
     // Leaf cannot have children - do nothing
-    std::cout << "Cannot remove from a leaf node." << std::endl;
+    LOG_WARN("Cannot remove from a leaf node.");
 }
 
 GreenhouseComponent* PlantLeaf::getChild(int index) const {
@@ -1,19 +1,33 @@
 #ifndef PLANTLEAF_H
 #define PLANTLEAF_H
 #include "GreenhouseComponent.h"
+#include "../Plant - Abstract Base/PlantHandle.h"
 
 class Plant;
+class PlantLeafIndex;
 
 class PlantLeaf : public GreenhouseComponent {
 private:
-    Plant* plant;
+    PlantHandle plant;   // Does not own the plant; reads as nullptr once it is destroyed
+
+    // ========== PlantLeafIndex links ==========
+    PlantLeafIndex* index;              // Index this leaf is linked into (nullptr if none)
+    const Plant* indexedPlant;
+    PlantLeaf* prevLeafOfPlant;         // Other leaves showing the same plant
+    PlantLeaf* nextLeafOfPlant;
+    friend class PlantLeafIndex;
+
+protected:
+    SubtreeAggregates computeAggregates() const override;
+    void describe(std::string& line) const override;
     
 public:
     PlantLeaf(Plant* p, const std::string& name = "Plant");
     virtual ~PlantLeaf();
     
-    void display(int depth = 0) const override;
     Plant* getPlant() const;
+    PlantHandle getHandle() const;
+    PlantLeaf* getNextLeafOfPlant() const;   // Next leaf showing the same plant, or nullptr
     void add(GreenhouseComponent* component) override;
     void remove(GreenhouseComponent* component) override;
     GreenhouseComponent* getChild(int index) const override;
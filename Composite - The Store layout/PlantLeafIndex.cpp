@@ -0,0 +1,92 @@
+#include "PlantLeafIndex.h"
+#include "PlantLeaf.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include "../Plant - Abstract Base/PlantStore.h"
+
+PlantLeafIndex::~PlantLeafIndex() {
+    for (auto& entry : firstLeaf) {
+        PlantLeaf* leaf = entry.second;
+        while (leaf) {
+            PlantLeaf* next = leaf->nextLeafOfPlant;
+            leaf->index = nullptr;
+            leaf->indexedPlant = nullptr;
+            leaf->prevLeafOfPlant = nullptr;
+            leaf->nextLeafOfPlant = nullptr;
+            leaf = next;
+        }
+    }
+}
+
+PlantLeafIndex& PlantLeafIndex::forStore(PlantStore* store) {
+    if (!store->leafIndex) {
+        store->leafIndex.reset(new PlantLeafIndex());
+        store->addObserver(store->leafIndex.get());
+    }
+    return *store->leafIndex;
+}
+
+void PlantLeafIndex::link(PlantLeaf* leaf, const Plant* plant) {
+    PlantLeaf*& head = firstLeaf[plant];
+    leaf->indexedPlant = plant;
+    leaf->prevLeafOfPlant = nullptr;
+    leaf->nextLeafOfPlant = head;
+    if (head) {
+        head->prevLeafOfPlant = leaf;
+    }
+    head = leaf;
+    leaf->index = this;
+}
+
+void PlantLeafIndex::unlink(PlantLeaf* leaf) {
+    if (leaf->prevLeafOfPlant) {
+        leaf->prevLeafOfPlant->nextLeafOfPlant = leaf->nextLeafOfPlant;
+    } else if (leaf->nextLeafOfPlant) {
+        firstLeaf[leaf->indexedPlant] = leaf->nextLeafOfPlant;
+    } else {
+        firstLeaf.erase(leaf->indexedPlant);
+    }
+    if (leaf->nextLeafOfPlant) {
+        leaf->nextLeafOfPlant->prevLeafOfPlant = leaf->prevLeafOfPlant;
+    }
+    leaf->prevLeafOfPlant = nullptr;
+    leaf->nextLeafOfPlant = nullptr;
+    leaf->indexedPlant = nullptr;
+    leaf->index = nullptr;
+}
+
+PlantLeaf* PlantLeafIndex::leafOf(const Plant* plant) {
+    const PlantStore* store = plant->getStore();
+    return store->leafIndex ? store->leafIndex->firstLeafOf(plant) : nullptr;
+}
+
+PlantLeaf* PlantLeafIndex::firstLeafOf(const Plant* plant) const {
+    auto it = firstLeaf.find(plant);
+    return it == firstLeaf.end() ? nullptr : it->second;
+}
+
+// ========== PlantStoreObserver ==========
+
+void PlantLeafIndex::plantChanged(Plant* plant) {
+    for (PlantLeaf* leaf = firstLeafOf(plant); leaf; leaf = leaf->nextLeafOfPlant) {
+        leaf->invalidateAggregates();
+    }
+}
+
+void PlantLeafIndex::storeTicked() {
+    for (auto& entry : firstLeaf) {
+        for (PlantLeaf* leaf = entry.second; leaf; leaf = leaf->nextLeafOfPlant) {
+            leaf->invalidateAggregates();
+        }
+    }
+}
+
+void PlantLeafIndex::plantReleased(Plant* plant) {
+    // The leaves stay in the tree but now show no plant
+    PlantLeaf* leaf = firstLeafOf(plant);
+    while (leaf) {
+        PlantLeaf* next = leaf->nextLeafOfPlant;
+        leaf->invalidateAggregates();
+        unlink(leaf);
+        leaf = next;
+    }
+}
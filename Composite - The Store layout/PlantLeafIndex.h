@@ -0,0 +1,57 @@
+#ifndef PLANTLEAFINDEX_H
+#define PLANTLEAFINDEX_H
+#include "../Plant - Abstract Base/PlantStoreObserver.h"
+#include <unordered_map>
+
+class Plant;
+class PlantLeaf;
+class PlantStore;
+
+/**
+ * @brief Plant -> PlantLeaf links for the plants of one PlantStore
+ *
+ * Every PlantLeaf registers here, so a change to a plant's values (or a tick
+ * of its store) can mark exactly the affected leaves' cached subtree totals
+ * as stale. Leaves of the same plant form an intrusive list; linking and
+ * unlinking are O(1).
+ *
+ * One index per store, created on first use and owned by the store. When
+ * the store is destroyed, leaves still linked are detached from the index.
+ */
+class PlantLeafIndex : public PlantStoreObserver {
+private:
+    std::unordered_map<const Plant*, PlantLeaf*> firstLeaf;   // Head of each plant's leaf list
+
+    PlantLeafIndex() = default;
+
+public:
+    ~PlantLeafIndex();
+
+    PlantLeafIndex(const PlantLeafIndex&) = delete;
+    PlantLeafIndex& operator=(const PlantLeafIndex&) = delete;
+
+    /**
+     * @brief Index for a store (created and registered as an observer on first use)
+     */
+    static PlantLeafIndex& forStore(PlantStore* store);
+
+    /**
+     * @brief A leaf showing the plant (the most recently created one), or nullptr
+     */
+    static PlantLeaf* leafOf(const Plant* plant);
+
+    void link(PlantLeaf* leaf, const Plant* plant);
+    void unlink(PlantLeaf* leaf);
+
+    /**
+     * @brief First leaf showing a plant (follow PlantLeaf::getNextLeafOfPlant()), or nullptr
+     */
+    PlantLeaf* firstLeafOf(const Plant* plant) const;
+
+    // ========== PlantStoreObserver ==========
+    void plantChanged(Plant* plant) override;
+    void storeTicked() override;
+    void plantReleased(Plant* plant) override;
+};
+
+#endif // PLANTLEAFINDEX_H
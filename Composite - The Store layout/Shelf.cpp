@@ -1,5 +1,5 @@
 #include "Shelf.h"
-#include <iostream>
+#include <string>
 
 Shelf::Shelf(int number, const std::string& name)
     : GreenhouseComponent(name), shelfNumber(number) {
@@ -9,16 +9,11 @@ Shelf::~Shelf() {
     // Base class destructor will handle children
 }
 
-void Shelf::display(int depth) const {
-    std::string indent(depth * 2, ' ');
-    std::cout << indent << "+ Shelf #" << shelfNumber << ": " << getName() << std::endl;
-    
-    // Display all children (plants on this shelf)
-    for (const auto& child : children) {
-        if (child) {
-            child->display(depth + 1);
-        }
-    }
+void Shelf::describe(std::string& line) const {
+    line += "+ Shelf #";
+    line += std::to_string(shelfNumber);
+    line += ": ";
+    line += name;
 }
 
 int Shelf::getShelfNumber() const {
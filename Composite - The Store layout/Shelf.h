@@ -5,12 +5,14 @@
 class Shelf : public GreenhouseComponent {
 private:
     int shelfNumber;
+
+protected:
+    void describe(std::string& line) const override;
     
 public:
     Shelf(int number, const std::string& name = "Shelf");
     virtual ~Shelf();
     
-    void display(int depth = 0) const override;
     int getShelfNumber() const;
     bool isComposite() const override;
 };
@@ -0,0 +1,34 @@
+#ifndef SUBTREEAGGREGATES_H
+#define SUBTREEAGGREGATES_H
+
+#include <limits>
+
+/**
+ * @brief Totals over the plants below a greenhouse component
+ */
+struct SubtreeAggregates {
+    int plantCount = 0;
+    int readyCount = 0;
+    double totalValue = 0.0;                              // Sum of base prices
+    int minHealth = std::numeric_limits<int>::max();      // max() when there are no plants
+
+    void addPlant(double price, int health, bool ready) {
+        plantCount++;
+        readyCount += ready ? 1 : 0;
+        totalValue += price;
+        if (health < minHealth) {
+            minHealth = health;
+        }
+    }
+
+    void merge(const SubtreeAggregates& other) {
+        plantCount += other.plantCount;
+        readyCount += other.readyCount;
+        totalValue += other.totalValue;
+        if (other.minHealth < minHealth) {
+            minHealth = other.minHealth;
+        }
+    }
+};
+
+#endif // SUBTREEAGGREGATES_H
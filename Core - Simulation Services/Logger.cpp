@@ -0,0 +1,185 @@
+#include "Logger.h"
+#include <iostream>
+
+Logger::Logger()
+    : level(static_cast<int>(LogLevel::Info)), sink(&std::cout),
+      ring(RING_SIZE), enqueuePos(0), dequeuePos(0), pending(0),
+      async(false), running(false) {
+    for (size_t i = 0; i < RING_SIZE; i++) {
+        ring[i].sequence.store(i, std::memory_order_relaxed);
+        ring[i].level = LogLevel::Info;
+    }
+}
+
+Logger::~Logger() {
+    stopAsync();
+    flush();
+}
+
+Logger& Logger::getInstance() {
+    static Logger instance;
+    return instance;
+}
+
+// ========== CONFIGURATION ==========
+
+void Logger::setLevel(LogLevel minimum) {
+    level.store(static_cast<int>(minimum), std::memory_order_relaxed);
+}
+
+LogLevel Logger::getLevel() const {
+    return static_cast<LogLevel>(level.load(std::memory_order_relaxed));
+}
+
+void Logger::setSilent(bool silent) {
+    setLevel(silent ? LogLevel::Off : LogLevel::Info);
+}
+
+void Logger::setSink(std::ostream* out) {
+    flush();
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    sink = out ? out : &std::cout;
+}
+
+const char* Logger::levelName(LogLevel messageLevel) {
+    switch (messageLevel) {
+        case LogLevel::Trace: return "TRACE";
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info:  return "INFO";
+        case LogLevel::Warn:  return "WARN";
+        case LogLevel::Error: return "ERROR";
+        case LogLevel::Off:   return "OFF";
+    }
+    return "UNKNOWN";
+}
+
+// ========== ASYNC WRITER ==========
+
+void Logger::startAsync() {
+    std::lock_guard<std::mutex> lock(controlMutex);
+    if (running.load()) {
+        return;
+    }
+    running.store(true);
+    writer = std::thread(&Logger::writerLoop, this);
+    async.store(true, std::memory_order_release);
+}
+
+void Logger::stopAsync() {
+    std::lock_guard<std::mutex> lock(controlMutex);
+    if (!running.load()) {
+        return;
+    }
+    async.store(false, std::memory_order_release);
+    running.store(false);
+    pending.fetch_add(1, std::memory_order_release);
+    pending.notify_one();
+    writer.join();
+
+    // Anything a producer queued while we were shutting down
+    std::string batch;
+    while (drainBatch(batch) > 0) {
+        std::lock_guard<std::mutex> sinkLock(sinkMutex);
+        sink->write(batch.data(), static_cast<std::streamsize>(batch.size()));
+        batch.clear();
+    }
+}
+
+bool Logger::isAsync() const {
+    return async.load(std::memory_order_acquire);
+}
+
+void Logger::writerLoop() {
+    std::string batch;
+    batch.reserve(64 * 1024);
+    while (true) {
+        int seen = pending.load(std::memory_order_acquire);
+        size_t drained = drainBatch(batch);
+        if (drained > 0) {
+            std::lock_guard<std::mutex> lock(sinkMutex);
+            sink->write(batch.data(), static_cast<std::streamsize>(batch.size()));
+            sink->flush();
+            batch.clear();
+            continue;
+        }
+        if (!running.load()) {
+            break;
+        }
+        // Sleep until a producer publishes something after 'seen'
+        pending.wait(seen, std::memory_order_acquire);
+    }
+}
+
+size_t Logger::drainBatch(std::string& batch) {
+    size_t count = 0;
+    size_t pos = dequeuePos.load(std::memory_order_relaxed);
+    while (count < RING_SIZE) {
+        Cell& cell = ring[pos & RING_MASK];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != pos + 1) {
+            break;  // Not yet published
+        }
+        batch += cell.text;
+        batch += '\n';
+        cell.text.clear();
+        cell.sequence.store(pos + RING_SIZE, std::memory_order_release);
+        pos++;
+        count++;
+    }
+    dequeuePos.store(pos, std::memory_order_release);
+    return count;
+}
+
+// ========== WRITING ==========
+
+void Logger::writeNow(LogLevel messageLevel, const std::string& message) {
+    (void)messageLevel;
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    sink->write(message.data(), static_cast<std::streamsize>(message.size()));
+    sink->put('\n');
+}
+
+void Logger::write(LogLevel messageLevel, std::string message) {
+    if (!isEnabled(messageLevel)) {
+        return;
+    }
+    if (!async.load(std::memory_order_acquire)) {
+        writeNow(messageLevel, message);
+        return;
+    }
+
+    size_t pos = enqueuePos.load(std::memory_order_relaxed);
+    while (true) {
+        Cell& cell = ring[pos & RING_MASK];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.level = messageLevel;
+                cell.text = std::move(message);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                pending.fetch_add(1, std::memory_order_release);
+                pending.notify_one();
+                return;
+            }
+        } else if (diff < 0) {
+            // Ring full - wait for the writer rather than dropping the message
+            std::this_thread::yield();
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::flush() {
+    size_t target = enqueuePos.load(std::memory_order_acquire);
+    if (running.load()) {
+        while (dequeuePos.load(std::memory_order_acquire) < target) {
+            pending.notify_one();
+            std::this_thread::yield();
+        }
+    }
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    sink->flush();
+}
@@ -0,0 +1,153 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Severity of a log message
+ */
+enum class LogLevel {
+    Trace = 0,
+    Debug = 1,
+    Info = 2,
+    Warn = 3,
+    Error = 4,
+    Off = 5
+};
+
+// Messages below this level are removed at compile time (0 = keep everything,
+// 5 = strip all logging). Set with -DGREENHOUSE_LOG_COMPILE_LEVEL=<n>.
+#ifndef GREENHOUSE_LOG_COMPILE_LEVEL
+#define GREENHOUSE_LOG_COMPILE_LEVEL 0
+#endif
+
+/**
+ * @brief Level-filtered logging sink used by the simulation modules
+ *
+ * Messages are written without a per-line flush. In the default synchronous
+ * mode they go straight to the sink, so they stay in order with direct console
+ * output (the interactive menus rely on this). startAsync() switches to a
+ * bounded lock-free ring buffer: callers only build the message and claim a
+ * cell, and a background thread drains the ring in batches with one write per
+ * batch. Use flush() before mixing async log output with direct console output.
+ *
+ * setLevel(LogLevel::Off) silences everything (benchmark mode); disabled
+ * messages are never formatted.
+ */
+class Logger {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        LogLevel level;
+        std::string text;
+    };
+
+    static constexpr size_t RING_SIZE = 4096;          // Power of two
+    static constexpr size_t RING_MASK = RING_SIZE - 1;
+
+    std::atomic<int> level;
+    std::ostream* sink;
+    std::mutex sinkMutex;                               // Serialises writes to the sink
+
+    // ========== ASYNC RING (multi-producer, single consumer) ==========
+    std::vector<Cell> ring;
+    std::atomic<size_t> enqueuePos;
+    std::atomic<size_t> dequeuePos;
+    std::atomic<int> pending;                           // Bumped per message; wakes the writer thread
+    std::atomic<bool> async;
+    std::atomic<bool> running;
+    std::thread writer;
+    std::mutex controlMutex;                            // Guards start/stop
+
+    Logger();
+
+    void writerLoop();
+    size_t drainBatch(std::string& batch);
+    void writeNow(LogLevel level, const std::string& message);
+
+public:
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    static Logger& getInstance();
+
+    /**
+     * @brief Lowest level that is written (LogLevel::Off silences the logger)
+     */
+    void setLevel(LogLevel minimum);
+    LogLevel getLevel() const;
+
+    /**
+     * @brief Whether a message of this level would be written
+     */
+    bool isEnabled(LogLevel messageLevel) const {
+        return static_cast<int>(messageLevel) >= level.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Silent mode for benchmarks (same as setLevel(LogLevel::Off))
+     */
+    void setSilent(bool silent);
+
+    /**
+     * @brief Redirect output (flushes pending messages first)
+     * @param out Stream to write to (not owned); nullptr restores std::cout
+     */
+    void setSink(std::ostream* out);
+
+    /**
+     * @brief Start the background writer thread
+     */
+    void startAsync();
+
+    /**
+     * @brief Drain the ring and return to synchronous writes
+     */
+    void stopAsync();
+
+    bool isAsync() const;
+
+    /**
+     * @brief Queue or write one message (a newline is appended)
+     */
+    void write(LogLevel messageLevel, std::string message);
+
+    /**
+     * @brief Block until every queued message has reached the sink
+     */
+    void flush();
+
+    static const char* levelName(LogLevel messageLevel);
+};
+
+// ========== LOGGING MACROS ==========
+// The message is a stream expression, e.g. LOG_INFO("Plant #" << id << " watered").
+// Levels below GREENHOUSE_LOG_COMPILE_LEVEL compile to nothing; disabled levels
+// cost one relaxed load and never format the message.
+#define GREENHOUSE_LOG(lvl, expr)                                                   \
+    do {                                                                            \
+        if (static_cast<int>(lvl) >= GREENHOUSE_LOG_COMPILE_LEVEL &&                \
+            Logger::getInstance().isEnabled(lvl)) {                                 \
+            std::ostringstream greenhouseLogStream;                                 \
+            greenhouseLogStream << expr;                                            \
+            Logger::getInstance().write(lvl, greenhouseLogStream.str());            \
+        }                                                                           \
+    } while (0)
+
+#define LOG_TRACE(expr) GREENHOUSE_LOG(LogLevel::Trace, expr)
+#define LOG_DEBUG(expr) GREENHOUSE_LOG(LogLevel::Debug, expr)
+#define LOG_INFO(expr)  GREENHOUSE_LOG(LogLevel::Info, expr)
+#define LOG_WARN(expr)  GREENHOUSE_LOG(LogLevel::Warn, expr)
+#define LOG_ERROR(expr) GREENHOUSE_LOG(LogLevel::Error, expr)
+
+#endif // LOGGER_H
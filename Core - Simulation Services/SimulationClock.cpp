@@ -0,0 +1,19 @@
+#include "SimulationClock.h"
+#include "VirtualClock.h"
+
+namespace {
+    SimulationClock* activeClock = nullptr;
+
+    SimulationClock& defaultClock() {
+        static VirtualClock instance;
+        return instance;
+    }
+}
+
+SimulationClock& SimulationClock::getInstance() {
+    return activeClock ? *activeClock : defaultClock();
+}
+
+void SimulationClock::setInstance(SimulationClock* clock) {
+    activeClock = clock;
+}
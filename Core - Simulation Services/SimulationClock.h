@@ -0,0 +1,52 @@
+#ifndef SIMULATIONCLOCK_H
+#define SIMULATIONCLOCK_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Source of timestamps for the simulation
+ *
+ * Timestamps are plain int64 values in the clock's own unit (ticks for a
+ * VirtualClock, seconds since the epoch for a WallClock) and are only turned
+ * into text by format() when something is displayed.
+ *
+ * The active clock is process-wide; it defaults to a VirtualClock so a run is
+ * reproducible and independent of real time.
+ */
+class SimulationClock {
+public:
+    static constexpr int64_t NEVER = -1;   // Timestamp of an event that has not happened
+
+    virtual ~SimulationClock() = default;
+
+    /**
+     * @brief Current timestamp
+     */
+    virtual int64_t now() const = 0;
+
+    /**
+     * @brief Move simulated time forward (ignored by clocks that follow real time)
+     * @param days Number of simulation days
+     */
+    virtual void advance(int days) = 0;
+
+    /**
+     * @brief Human-readable form of a timestamp from this clock
+     * @return Empty string for NEVER
+     */
+    virtual std::string format(int64_t timestamp) const = 0;
+
+    /**
+     * @brief Clock currently used by the simulation
+     */
+    static SimulationClock& getInstance();
+
+    /**
+     * @brief Replace the simulation clock
+     * @param clock Clock to use (not owned); nullptr restores the default VirtualClock
+     */
+    static void setInstance(SimulationClock* clock);
+};
+
+#endif // SIMULATIONCLOCK_H
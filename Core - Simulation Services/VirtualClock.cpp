@@ -0,0 +1,44 @@
+#include "VirtualClock.h"
+
+VirtualClock::VirtualClock(int perDay, int64_t startTick)
+    : ticks(startTick), ticksPerDay(perDay < 1 ? 1 : perDay) {
+}
+
+int64_t VirtualClock::now() const {
+    return ticks;
+}
+
+void VirtualClock::advance(int days) {
+    if (days > 0) {
+        ticks += static_cast<int64_t>(days) * ticksPerDay;
+    }
+}
+
+std::string VirtualClock::format(int64_t timestamp) const {
+    if (timestamp == NEVER) {
+        return "";
+    }
+    std::string text = "Day " + std::to_string(timestamp / ticksPerDay);
+    if (ticksPerDay > 1) {
+        text += ", tick " + std::to_string(timestamp % ticksPerDay);
+    }
+    return text;
+}
+
+void VirtualClock::advanceTicks(int64_t count) {
+    if (count > 0) {
+        ticks += count;
+    }
+}
+
+void VirtualClock::setTicks(int64_t tick) {
+    ticks = tick;
+}
+
+int VirtualClock::getTicksPerDay() const {
+    return ticksPerDay;
+}
+
+int64_t VirtualClock::getDay() const {
+    return ticks / ticksPerDay;
+}
@@ -0,0 +1,47 @@
+#ifndef VIRTUALCLOCK_H
+#define VIRTUALCLOCK_H
+
+#include "SimulationClock.h"
+
+/**
+ * @brief Simulated time as a tick counter
+ *
+ * Time only moves when the simulation advances it, so runs are reproducible
+ * and can go as fast as the hardware allows. A day is split into a fixed
+ * number of ticks (1 by default, i.e. one tick per day).
+ */
+class VirtualClock : public SimulationClock {
+private:
+    int64_t ticks;
+    int ticksPerDay;
+
+public:
+    /**
+     * @param ticksPerDay Resolution of the clock (clamped to at least 1)
+     * @param startTick Initial tick count
+     */
+    explicit VirtualClock(int ticksPerDay = 1, int64_t startTick = 0);
+
+    int64_t now() const override;
+    void advance(int days) override;
+    std::string format(int64_t timestamp) const override;
+
+    /**
+     * @brief Move forward by a number of ticks (finer than a day)
+     */
+    void advanceTicks(int64_t count);
+
+    /**
+     * @brief Jump to an absolute tick (e.g. when restoring a saved simulation)
+     */
+    void setTicks(int64_t tick);
+
+    int getTicksPerDay() const;
+
+    /**
+     * @brief Current simulation day (0-based)
+     */
+    int64_t getDay() const;
+};
+
+#endif // VIRTUALCLOCK_H
@@ -0,0 +1,25 @@
+#include "WallClock.h"
+#include <ctime>
+
+int64_t WallClock::now() const {
+    return static_cast<int64_t>(std::time(nullptr));
+}
+
+void WallClock::advance(int days) {
+    // Real time cannot be fast-forwarded
+    (void)days;
+}
+
+std::string WallClock::format(int64_t timestamp) const {
+    if (timestamp == NEVER) {
+        return "";
+    }
+    std::time_t when = static_cast<std::time_t>(timestamp);
+    std::tm* local = std::localtime(&when);
+    char buffer[32];
+    // Same layout as ctime(), without the trailing newline
+    if (!local || std::strftime(buffer, sizeof(buffer), "%a %b %d %H:%M:%S %Y", local) == 0) {
+        return "";
+    }
+    return buffer;
+}
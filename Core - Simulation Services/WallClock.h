@@ -0,0 +1,18 @@
+#ifndef WALLCLOCK_H
+#define WALLCLOCK_H
+
+#include "SimulationClock.h"
+
+/**
+ * @brief Real time in seconds since the epoch
+ *
+ * Matches the original ctime() timestamps; advance() has no effect.
+ */
+class WallClock : public SimulationClock {
+public:
+    int64_t now() const override;
+    void advance(int days) override;
+    std::string format(int64_t timestamp) const override;
+};
+
+#endif // WALLCLOCK_H
@@ -0,0 +1,149 @@
+#include "WorkStealingPool.h"
+
+namespace {
+    // Which pool (if any) the current thread works for, and its queue there
+    thread_local const WorkStealingPool* currentPool = nullptr;
+    thread_local size_t currentIndex = 0;
+}
+
+WorkStealingPool::WorkStealingPool(size_t threads)
+    : workerCount(0), queued(0), sleeping(0), stopping(false) {
+    if (threads == 0) {
+        unsigned hardware = std::thread::hardware_concurrency();
+        threads = hardware > 1 ? hardware - 1 : 0;
+    }
+    workerCount = threads;
+    queues.reset(new Queue[threads + 1]);
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; i++) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping.store(true);
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// ========== SCHEDULING ==========
+
+size_t WorkStealingPool::homeQueue() const {
+    return currentPool == this ? currentIndex : workerCount;
+}
+
+void WorkStealingPool::spawn(TaskGroup& group, Task task) {
+    group.pending.fetch_add(1);
+    queued.fetch_add(1);   // Counted before it is visible, so a thief never drives it below zero
+    try {
+        Task wrapped = [&group, task]() mutable {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(group.failureMutex);
+                if (!group.failure) {
+                    group.failure = std::current_exception();
+                }
+            }
+            task = nullptr;   // Release captures before the group can be destroyed by its waiter
+            group.pending.fetch_sub(1, std::memory_order_release);
+        };
+
+        Queue& queue = queues[homeQueue()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(wrapped));
+    } catch (...) {
+        queued.fetch_sub(1);
+        group.pending.fetch_sub(1);
+        throw;
+    }
+
+    // A worker that is about to sleep has bumped sleeping before re-checking
+    // queued, so one of the two sides always sees the other
+    if (sleeping.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wakeUp.notify_one();
+    }
+}
+
+bool WorkStealingPool::runOne(size_t home) {
+    const size_t count = workerCount + 1;
+    Task task;
+    {
+        Queue& own = queues[home];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+    for (size_t i = 1; !task && i < count; i++) {
+        Queue& victim = queues[(home + i) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+    if (!task) {
+        return false;
+    }
+    queued.fetch_sub(1);
+    task();
+    return true;
+}
+
+void WorkStealingPool::wait(TaskGroup& group) {
+    const size_t home = homeQueue();
+    while (group.pending.load(std::memory_order_acquire) != 0) {
+        if (!runOne(home)) {
+            std::this_thread::yield();   // The remaining tasks are running elsewhere
+        }
+    }
+
+    std::exception_ptr failure;
+    {
+        std::lock_guard<std::mutex> lock(group.failureMutex);
+        failure.swap(group.failure);
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+void WorkStealingPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentIndex = index;
+    for (;;) {
+        if (runOne(index)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleeping.fetch_add(1);
+        wakeUp.wait(lock, [this]() { return stopping.load() || queued.load() > 0; });
+        sleeping.fetch_sub(1);
+        if (stopping.load() && queued.load() == 0) {
+            return;
+        }
+    }
+}
+
+// ========== INFORMATION ==========
+
+size_t WorkStealingPool::getWorkerCount() const {
+    return workerCount;
+}
+
+size_t WorkStealingPool::getConcurrency() const {
+    return workerCount + 1;
+}
+
+WorkStealingPool& WorkStealingPool::shared() {
+    static WorkStealingPool pool;
+    return pool;
+}
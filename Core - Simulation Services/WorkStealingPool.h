@@ -0,0 +1,112 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed set of worker threads for fork-join work
+ *
+ * Every worker owns a task deque. A task spawned on a worker goes to the back
+ * of that worker's deque and is popped from the back again (newest first,
+ * while its data is still in cache); idle workers steal from the front of
+ * other deques, which holds the oldest and usually largest pieces of work.
+ * Tasks spawned from outside the pool go to a shared inbound deque.
+ *
+ * wait() does not block while tasks are queued: the waiting thread runs
+ * queued tasks itself until its group is finished, so nested fork-join never
+ * deadlocks and the calling thread counts as one more worker.
+ *
+ * An exception thrown by a task is caught on whichever thread ran it and
+ * rethrown by wait() once the whole group has finished. A caller whose own
+ * share of the work throws must still wait() before unwinding, since the
+ * spawned tasks may refer to its locals.
+ */
+class WorkStealingPool {
+public:
+    typedef std::function<void()> Task;
+
+    /**
+     * @brief Set of spawned tasks that wait() joins on
+     */
+    class TaskGroup {
+    private:
+        std::atomic<size_t> pending;
+        std::mutex failureMutex;
+        std::exception_ptr failure;      // First exception a task of the group threw
+        friend class WorkStealingPool;
+
+    public:
+        TaskGroup() : pending(0) {}
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+    };
+
+private:
+    struct alignas(64) Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    size_t workerCount;                  // Fixed before any worker starts
+    std::unique_ptr<Queue[]> queues;     // One per worker, then the inbound queue
+    std::vector<std::thread> workers;
+    std::atomic<size_t> queued;          // Tasks sitting in any queue
+    std::atomic<size_t> sleeping;
+    std::atomic<bool> stopping;
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+
+    void workerLoop(size_t index);
+    bool runOne(size_t home);            // Pop from home's back, else steal; false if all empty
+    size_t homeQueue() const;            // Calling worker's queue, or the inbound queue
+
+public:
+    /**
+     * @param threads Worker threads to start; 0 uses one per hardware thread
+     *        beyond the caller's
+     */
+    explicit WorkStealingPool(size_t threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Queue a task as part of group
+     *
+     * If queueing fails (std::bad_alloc), the task is not part of the group
+     * and the exception propagates.
+     */
+    void spawn(TaskGroup& group, Task task);
+
+    /**
+     * @brief Return once every task spawned in group has finished, running queued tasks meanwhile
+     *
+     * Rethrows the first exception thrown by a task of the group (after all of
+     * them have finished).
+     */
+    void wait(TaskGroup& group);
+
+    size_t getWorkerCount() const;
+
+    /**
+     * @brief Threads that can run tasks at once (workers plus the caller)
+     */
+    size_t getConcurrency() const;
+
+    /**
+     * @brief Process-wide pool sized to the machine
+     */
+    static WorkStealingPool& shared();
+};
+
+#endif // WORKSTEALINGPOOL_H
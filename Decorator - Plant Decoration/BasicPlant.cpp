@@ -10,15 +10,15 @@ BasicPlant::BasicPlant(Plant* p) : PlantProduct(p) {}
 BasicPlant::~BasicPlant() {}
 
 double BasicPlant::getPrice() const {
-    if (plant) {
-        return plant->getBasePrice();
+    if (Plant* p = getPlant()) {
+        return p->getBasePrice();
     }
     return 0.0;
 }
 
 std::string BasicPlant::getDescription() const {
-    if (plant) {
-        return plant->getSpecies() + " (Basic)";
+    if (Plant* p = getPlant()) {
+        return p->getSpecies() + " (Basic)";
     }
     return "Unknown Plant";
 }
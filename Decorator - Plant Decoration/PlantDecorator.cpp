@@ -20,7 +20,7 @@ PlantProduct* PlantDecorator::getWrappedProduct() const {
 void PlantDecorator::setWrappedProduct(PlantProduct* product) {
     wrappedProduct = product;
     if (product) {
-        plant = product->getPlant();
+        setPlant(product->getPlant());
     }
 }
 
@@ -2,7 +2,7 @@
 #include "../Plant - Abstract Base/Plant.h"
 #include <iostream>
 
-PlantProduct::PlantProduct() : plant(nullptr) {}
+PlantProduct::PlantProduct() : plant() {}
 
 PlantProduct::PlantProduct(Plant* p) : plant(p) {}
 
@@ -11,9 +11,9 @@ PlantProduct::~PlantProduct() {
 }
 
 Plant* PlantProduct::getPlant() const {
-    return plant;
+    return plant.get();
 }
 
 void PlantProduct::setPlant(Plant* p) {
-    plant = p;
+    plant = PlantHandle(p);
 }
\ No newline at end of file
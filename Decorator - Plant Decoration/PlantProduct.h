@@ -1,6 +1,7 @@
 #ifndef PLANTPRODUCT_H
 #define PLANTPRODUCT_H
 
+#include "../Plant - Abstract Base/PlantHandle.h"
 #include <string>
 
 class Plant;
@@ -13,7 +14,7 @@ class Plant;
  */
 class PlantProduct {
 protected:
-    Plant* plant;  // The actual plant being sold
+    PlantHandle plant;  // The actual plant being sold (nullptr once it is destroyed)
 
 public:
     PlantProduct();
@@ -1,18 +1,38 @@
 #include "BaobabFactory.h"
+#include "PlantPool.h"
+#include "../Flyweight - Species Traits/SpeciesRegistry.h"
 #include <iostream>
+#include <new>
+
+static const SpeciesTraits* baobabTraits()
+{
+    static const SpeciesTraits* traits = SpeciesRegistry::getInstance().intern(
+        SpeciesTraits("Baobab", "Adansonia", "sandy", "summer", 21, 10, 90, 120, 15.0, 150.00));
+    return traits;
+}
 
 class Baobab : public Plant
 {
 public:
-    Baobab() : Plant("Baobab", 120)
+    Baobab() : Plant(baobabTraits())
     {
-        initialize();
     }
 
     Baobab(const Baobab &other) : Plant(other) {}
 
     ~Baobab() override {}
 
+    // Instances come from the Baobab slab pool (see PlantPool)
+    static void *operator new(size_t size)
+    {
+        return PlantPool::forType<Baobab>("Baobab").allocate(size);
+    }
+
+    static void operator delete(void *object, size_t size)
+    {
+        PlantPool::forType<Baobab>("Baobab").deallocate(object, size);
+    }
+
     Plant *clone() const override
     {
         return new Baobab(*this);
@@ -25,15 +45,7 @@ public:
 
     void initialize() override
     {
-        setScientificName("Adansonia");
-        setHeight(15.0);
-        setBasePrice(150.00);
-        setWateringFrequency(21);
-        setSunlightRequirement(10);
-        setFertilizingFrequency(90);
-        setSoilType("sandy");
-        setHealthLevel(100);
-        setCurrentSeason("summer");
+        applySpeciesDefaults();
     }
 
     void display() const override
@@ -49,6 +61,12 @@ Plant* BaobabFactory::createPlant()
     return new Baobab();
 }
 
+size_t BaobabFactory::createPlants(size_t count, std::vector<Plant *> &out)
+{
+    return createBlock(count, out, PlantPool::forType<Baobab>("Baobab"), baobabTraits(),
+                       [](void *block) -> Plant * { return ::new (block) Baobab(); });
+}
+
 std::string BaobabFactory::getPlantType() const
 {
     return "Baobab";
@@ -8,6 +8,7 @@ class BaobabFactory : public PlantFactory
 public:
     virtual ~BaobabFactory() = default;
     Plant *createPlant() override;
+    size_t createPlants(size_t count, std::vector<Plant *> &out) override;
     std::string getPlantType() const override;
 };
 
@@ -1,15 +1,34 @@
 #include "CactusFactory.h"
+#include "PlantPool.h"
+#include "../Flyweight - Species Traits/SpeciesRegistry.h"
 #include <iostream>
+#include <new>
 
-Cactus::Cactus() : Plant("Cactus", 30)
+static const SpeciesTraits* cactusTraits()
+{
+    static const SpeciesTraits* traits = SpeciesRegistry::getInstance().intern(
+        SpeciesTraits("Cactus", "Cactaceae", "sandy", "summer", 14, 8, 60, 30, 3.0, 25.00));
+    return traits;
+}
+
+Cactus::Cactus() : Plant(cactusTraits())
 {
-    initialize();
 }
 
 Cactus::Cactus(const Cactus &other) : Plant(other) {}
 
 Cactus::~Cactus() {}
 
+void *Cactus::operator new(size_t size)
+{
+    return PlantPool::forType<Cactus>("Cactus").allocate(size);
+}
+
+void Cactus::operator delete(void *object, size_t size)
+{
+    PlantPool::forType<Cactus>("Cactus").deallocate(object, size);
+}
+
 Plant *Cactus::clone() const
 {
     return new Cactus(*this);
@@ -22,15 +41,7 @@ std::string Cactus::getType() const
 
 void Cactus::initialize()
 {
-    setScientificName("Cactaceae");
-    setHeight(3.0);
-    setBasePrice(25.00);
-    setWateringFrequency(14);
-    setSunlightRequirement(8);
-    setFertilizingFrequency(60);
-    setSoilType("sandy");
-    setHealthLevel(100);
-    setCurrentSeason("summer");
+    applySpeciesDefaults();
 }
 
 void Cactus::display() const
@@ -45,6 +56,12 @@ Plant* CactusFactory::createPlant()
     return new Cactus();
 }
 
+size_t CactusFactory::createPlants(size_t count, std::vector<Plant*>& out)
+{
+    return createBlock(count, out, PlantPool::forType<Cactus>("Cactus"), cactusTraits(),
+                       [](void* block) -> Plant* { return ::new (block) Cactus(); });
+}
+
 std::string CactusFactory::getPlantType() const
 {
     return "Cactus";
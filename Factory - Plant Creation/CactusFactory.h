@@ -10,6 +10,10 @@ public:
     Cactus(const Cactus &other);
     ~Cactus() override;
 
+    // Instances come from the Cactus slab pool (see PlantPool)
+    static void *operator new(size_t size);
+    static void operator delete(void *object, size_t size);
+
     Plant *clone() const override;
     std::string getType() const override;
     void initialize() override;
@@ -20,6 +24,7 @@ class CactusFactory : public PlantFactory {
 public:
     virtual ~CactusFactory() = default;
     Plant* createPlant() override;
+    size_t createPlants(size_t count, std::vector<Plant*>& out) override;
     std::string getPlantType() const override;
 };
 
@@ -1,15 +1,34 @@
 #include "LavenderFactory.h"
+#include "PlantPool.h"
+#include "../Flyweight - Species Traits/SpeciesRegistry.h"
 #include <iostream>
+#include <new>
 
-Lavender::Lavender() : Plant("Lavender", 60)
+static const SpeciesTraits* lavenderTraits()
+{
+    static const SpeciesTraits* traits = SpeciesRegistry::getInstance().intern(
+        SpeciesTraits("Lavender", "Lavandula", "sandy", "summer", 7, 7, 30, 60, 8.0, 35.00));
+    return traits;
+}
+
+Lavender::Lavender() : Plant(lavenderTraits())
 {
-    initialize();
 }
 
 Lavender::Lavender(const Lavender &other) : Plant(other) {}
 
 Lavender::~Lavender() {}
 
+void *Lavender::operator new(size_t size)
+{
+    return PlantPool::forType<Lavender>("Lavender").allocate(size);
+}
+
+void Lavender::operator delete(void *object, size_t size)
+{
+    PlantPool::forType<Lavender>("Lavender").deallocate(object, size);
+}
+
 Plant *Lavender::clone() const
 {
     return new Lavender(*this);
@@ -22,15 +41,7 @@ std::string Lavender::getType() const
 
 void Lavender::initialize()
 {
-    setScientificName("Lavandula");
-    setHeight(8.0);
-    setBasePrice(35.00);
-    setWateringFrequency(7);
-    setSunlightRequirement(7);
-    setFertilizingFrequency(30);
-    setSoilType("sandy");
-    setHealthLevel(100);
-    setCurrentSeason("summer");
+    applySpeciesDefaults();
 }
 
 void Lavender::display() const
@@ -45,6 +56,12 @@ Plant* LavenderFactory::createPlant()
     return new Lavender();
 }
 
+size_t LavenderFactory::createPlants(size_t count, std::vector<Plant*>& out)
+{
+    return createBlock(count, out, PlantPool::forType<Lavender>("Lavender"), lavenderTraits(),
+                       [](void* block) -> Plant* { return ::new (block) Lavender(); });
+}
+
 std::string LavenderFactory::getPlantType() const
 {
     return "Lavender";
@@ -10,6 +10,10 @@ public:
     Lavender(const Lavender &other);
     ~Lavender() override;
 
+    // Instances come from the Lavender slab pool (see PlantPool)
+    static void *operator new(size_t size);
+    static void operator delete(void *object, size_t size);
+
     Plant *clone() const override;
     std::string getType() const override;
     void initialize() override;
@@ -20,6 +24,7 @@ class LavenderFactory : public PlantFactory {
 public:
     virtual ~LavenderFactory() = default;
     Plant* createPlant() override;
+    size_t createPlants(size_t count, std::vector<Plant*>& out) override;
     std::string getPlantType() const override;
 };
 
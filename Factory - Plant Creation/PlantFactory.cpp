@@ -0,0 +1,52 @@
+#include "PlantFactory.h"
+#include "PlantPool.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include "../Plant - Abstract Base/PlantStore.h"
+#include <atomic>
+
+namespace
+{
+    std::atomic<int> nextPlantId(1);
+}
+
+int PlantFactory::reservePlantIds(size_t count)
+{
+    return nextPlantId.fetch_add(static_cast<int>(count));
+}
+
+size_t PlantFactory::createPlants(size_t count, std::vector<Plant *> &out)
+{
+    int firstId = reservePlantIds(count);
+    out.reserve(out.size() + count);
+    for (size_t i = 0; i < count; i++)
+    {
+        Plant *plant = createPlant();
+        plant->setPlantId(firstId + static_cast<int>(i));
+        out.push_back(plant);
+    }
+    return count;
+}
+
+size_t PlantFactory::createBlock(size_t count, std::vector<Plant *> &out, PlantPool &pool,
+                                 const SpeciesTraits *traits, Plant *(*construct)(void *block))
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    PlantStore &store = PlantStore::getInstance();
+    size_t firstSlot = store.appendSlots(count, traits, reservePlantIds(count));
+    unsigned char *blocks = static_cast<unsigned char *>(pool.allocateRun(count));
+    const size_t stride = pool.getBlockStride();
+
+    // Each handle adopts its pre-filled slot, so the constructors neither
+    // reset the slot nor re-apply the species defaults
+    out.reserve(out.size() + count);
+    for (size_t i = 0; i < count; i++)
+    {
+        store.adoptNextAllocation(firstSlot + i);
+        out.push_back(construct(blocks + i * stride));
+    }
+    return count;
+}
@@ -1,10 +1,14 @@
 #ifndef PLANTFACTORY_H
 #define PLANTFACTORY_H
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
-// Forward declaration
+// Forward declarations
 class Plant;
+class PlantPool;
+class SpeciesTraits;
 
 /**
  * @brief Abstract Factory class for creating Plant objects
@@ -14,6 +18,19 @@ class Plant;
  */
 class PlantFactory
 {
+protected:
+    /**
+     * @brief Shared batch path for the concrete factories
+     *
+     * Reserves a block of plant IDs, appends one run of store slots filled
+     * with the species defaults column by column, takes one contiguous run of
+     * blocks from the species pool and constructs every plant in place.
+     *
+     * @param construct Placement-constructs one plant in the given block
+     */
+    static size_t createBlock(size_t count, std::vector<Plant *> &out, PlantPool &pool,
+                              const SpeciesTraits *traits, Plant *(*construct)(void *block));
+
 public:
     /**
      * @brief Virtual destructor
@@ -26,6 +43,24 @@ public:
      */
     virtual Plant *createPlant() = 0;
 
+    /**
+     * @brief Create a batch of plants with consecutive IDs
+     *
+     * The default creates them one at a time with createPlant(); concrete
+     * factories construct the whole batch in one contiguous block.
+     *
+     * @param count Number of plants to create
+     * @param out Receives the new plants (caller takes ownership)
+     * @return Number of plants appended to out
+     */
+    virtual size_t createPlants(size_t count, std::vector<Plant *> &out);
+
+    /**
+     * @brief Reserve a block of consecutive plant IDs (thread-safe)
+     * @return First ID of the block
+     */
+    static int reservePlantIds(size_t count);
+
     /**
      * @brief Get the plant type this factory creates
      * @return String representing the plant type
@@ -0,0 +1,337 @@
+#include "PlantPool.h"
+#include "../Core - Simulation Services/Logger.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+    // Each block is a small header (live flag) followed by the object
+    const size_t HEADER_SIZE = 16;
+    const size_t SLAB_HEADER_SIZE = 16;
+    const size_t MAX_CACHED_POOLS = 32;
+    const size_t CACHE_BATCH = 32;        // Blocks moved between a thread cache and its pool at once
+    const size_t CACHE_LIMIT = 2 * CACHE_BATCH;
+
+    size_t roundUp(size_t value) {
+        return (value + 15) & ~static_cast<size_t>(15);
+    }
+
+    uint32_t& liveFlag(void* object) {
+        return *reinterpret_cast<uint32_t*>(static_cast<unsigned char*>(object) - HEADER_SIZE);
+    }
+
+    void*& nextFree(void* object) {
+        return *static_cast<void**>(object);
+    }
+
+    std::mutex& registryMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    std::vector<PlantPool*>& registry() {
+        static std::vector<PlantPool*> pools;
+        return pools;
+    }
+}
+
+/**
+ * @brief Per-thread free lists, one per pool; handed back to the pools on thread exit
+ */
+struct PlantPoolThreadCache {
+    struct Entry {
+        PlantPool* pool;
+        void* head;
+        size_t count;
+        uint64_t epoch;
+    };
+    Entry entries[MAX_CACHED_POOLS];
+
+    PlantPoolThreadCache() : entries() {}
+
+    ~PlantPoolThreadCache() {
+        for (Entry& entry : entries) {
+            if (entry.pool && entry.count > 0) {
+                PlantPool& pool = *entry.pool;
+                std::lock_guard<std::mutex> lock(pool.mutex);
+                if (entry.epoch == pool.epoch.load()) {
+                    while (entry.head) {
+                        void* object = entry.head;
+                        entry.head = nextFree(object);
+                        nextFree(object) = pool.freeList;
+                        pool.freeList = object;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Entry for a pool, emptied if the pool was released since it was filled
+     */
+    Entry& forPool(PlantPool& pool) {
+        Entry& entry = entries[pool.id];
+        uint64_t current = pool.epoch.load();
+        if (entry.pool != &pool || entry.epoch != current) {
+            entry.pool = &pool;
+            entry.head = nullptr;
+            entry.count = 0;
+            entry.epoch = current;
+        }
+        return entry;
+    }
+};
+
+namespace {
+    thread_local PlantPoolThreadCache threadCache;
+}
+
+std::atomic<bool> PlantPool::threadCaching(false);
+
+PlantPool::PlantPool(const std::string& poolName, size_t size, void (*destroyObject)(void*))
+    : name(poolName), objectSize(size), blockSize(HEADER_SIZE + roundUp(size)),
+      destroy(destroyObject), id(0), slabs(nullptr), slabCount(0), blockCount(0), freeList(nullptr),
+      live(0), peakLive(0), allocations(0), epoch(0) {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    id = registry().size();
+    registry().push_back(this);
+}
+
+PlantPool::~PlantPool() {
+    releaseAll();
+    std::lock_guard<std::mutex> lock(registryMutex());
+    std::vector<PlantPool*>& pools = registry();
+    for (size_t i = 0; i < pools.size(); i++) {
+        if (pools[i] == this) {
+            pools[i] = nullptr;   // Keep the other pools' cache indices stable
+        }
+    }
+}
+
+// ========== SLABS ==========
+
+PlantPool::Slab* PlantPool::carveSlab(size_t capacity) {
+    void* memory = std::malloc(SLAB_HEADER_SIZE + capacity * blockSize);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    Slab* slab = static_cast<Slab*>(memory);
+    slab->next = slabs;
+    slab->capacity = capacity;
+    slabs = slab;
+    slabCount++;
+    blockCount += capacity;
+    return slab;
+}
+
+void* PlantPool::popLocked() {
+    if (!freeList) {
+        // Thread the new blocks onto the free list in address order
+        unsigned char* blocks = reinterpret_cast<unsigned char*>(carveSlab(OBJECTS_PER_SLAB)) +
+                                SLAB_HEADER_SIZE;
+        for (size_t i = OBJECTS_PER_SLAB; i-- > 0;) {
+            void* object = blocks + i * blockSize + HEADER_SIZE;
+            liveFlag(object) = 0;
+            nextFree(object) = freeList;
+            freeList = object;
+        }
+    }
+    void* object = freeList;
+    freeList = nextFree(object);
+    return object;
+}
+
+// ========== ALLOCATION ==========
+
+void* PlantPool::allocate(size_t size) {
+    if (size != objectSize) {
+        return ::operator new(size);
+    }
+
+    void* object;
+    if (threadCaching.load(std::memory_order_relaxed) && id < MAX_CACHED_POOLS) {
+        PlantPoolThreadCache::Entry& entry = threadCache.forPool(*this);
+        if (entry.count == 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < CACHE_BATCH; i++) {
+                void* refill = popLocked();
+                nextFree(refill) = entry.head;
+                entry.head = refill;
+            }
+            entry.count = CACHE_BATCH;
+        }
+        object = entry.head;
+        entry.head = nextFree(object);
+        entry.count--;
+    } else {
+        std::lock_guard<std::mutex> lock(mutex);
+        object = popLocked();
+    }
+
+    liveFlag(object) = 1;
+    noteAllocated(1);
+    return object;
+}
+
+void* PlantPool::allocateRun(size_t count) {
+    if (count == 0) {
+        return nullptr;
+    }
+    unsigned char* blocks;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        blocks = reinterpret_cast<unsigned char*>(carveSlab(count)) + SLAB_HEADER_SIZE;
+    }
+    for (size_t i = 0; i < count; i++) {
+        liveFlag(blocks + i * blockSize + HEADER_SIZE) = 1;
+    }
+    noteAllocated(count);
+    return blocks + HEADER_SIZE;
+}
+
+size_t PlantPool::getBlockStride() const {
+    return blockSize;
+}
+
+void PlantPool::noteAllocated(size_t count) {
+    allocations.fetch_add(count, std::memory_order_relaxed);
+    size_t now = live.fetch_add(count) + count;
+    size_t peak = peakLive.load(std::memory_order_relaxed);
+    while (now > peak && !peakLive.compare_exchange_weak(peak, now)) {
+    }
+}
+
+void PlantPool::deallocate(void* object, size_t size) {
+    if (!object) {
+        return;
+    }
+    if (size != objectSize) {
+        ::operator delete(object);
+        return;
+    }
+
+    liveFlag(object) = 0;
+    live.fetch_sub(1);
+
+    if (threadCaching.load(std::memory_order_relaxed) && id < MAX_CACHED_POOLS) {
+        PlantPoolThreadCache::Entry& entry = threadCache.forPool(*this);
+        nextFree(object) = entry.head;
+        entry.head = object;
+        entry.count++;
+        if (entry.count > CACHE_LIMIT) {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < CACHE_BATCH; i++) {
+                void* spill = entry.head;
+                entry.head = nextFree(spill);
+                nextFree(spill) = freeList;
+                freeList = spill;
+            }
+            entry.count -= CACHE_BATCH;
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    nextFree(object) = freeList;
+    freeList = object;
+}
+
+// ========== BULK RELEASE ==========
+
+size_t PlantPool::releaseAll() {
+    Slab* released;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = slabs;
+        slabs = nullptr;
+        slabCount = 0;
+        blockCount = 0;
+        freeList = nullptr;
+        epoch.fetch_add(1);   // Blocks cached by any thread now belong to freed slabs
+    }
+
+    // Destructors run outside the lock; the slabs are already detached
+    size_t destroyed = 0;
+    while (released) {
+        Slab* slab = released;
+        released = slab->next;
+        unsigned char* blocks = reinterpret_cast<unsigned char*>(slab) + SLAB_HEADER_SIZE;
+        for (size_t i = 0; i < slab->capacity; i++) {
+            void* object = blocks + i * blockSize + HEADER_SIZE;
+            if (liveFlag(object)) {
+                destroy(object);
+                destroyed++;
+            }
+        }
+        std::free(slab);
+    }
+    live.fetch_sub(destroyed);
+    return destroyed;
+}
+
+PlantPool::Stats PlantPool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats stats;
+    stats.name = name;
+    stats.objectSize = objectSize;
+    stats.liveObjects = live.load();
+    stats.peakLiveObjects = peakLive.load();
+    stats.totalAllocations = allocations.load();
+    stats.slabCount = slabCount;
+    stats.capacity = blockCount;
+    stats.bytesReserved = slabCount * SLAB_HEADER_SIZE + blockCount * blockSize;
+    stats.emptySlabs = 0;
+    for (Slab* slab = slabs; slab; slab = slab->next) {
+        unsigned char* blocks = reinterpret_cast<unsigned char*>(slab) + SLAB_HEADER_SIZE;
+        bool empty = true;
+        for (size_t i = 0; i < slab->capacity && empty; i++) {
+            empty = liveFlag(blocks + i * blockSize + HEADER_SIZE) == 0;
+        }
+        if (empty) {
+            stats.emptySlabs++;
+        }
+    }
+    stats.fragmentation = stats.capacity == 0
+        ? 0.0
+        : 1.0 - static_cast<double>(stats.liveObjects) / static_cast<double>(stats.capacity);
+    return stats;
+}
+
+// ========== POOL REGISTRY ==========
+
+std::vector<PlantPool*> PlantPool::getPools() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    std::vector<PlantPool*> pools;
+    for (PlantPool* pool : registry()) {
+        if (pool) {
+            pools.push_back(pool);
+        }
+    }
+    return pools;
+}
+
+size_t PlantPool::releaseAllPools() {
+    size_t destroyed = 0;
+    for (PlantPool* pool : getPools()) {
+        destroyed += pool->releaseAll();
+    }
+    return destroyed;
+}
+
+void PlantPool::reportStats() {
+    for (PlantPool* pool : getPools()) {
+        Stats stats = pool->getStats();
+        LOG_INFO("[PlantPool] " << stats.name << ": " << stats.liveObjects << " live (peak "
+                 << stats.peakLiveObjects << "), " << stats.slabCount << " slabs / "
+                 << stats.capacity << " blocks, " << stats.emptySlabs << " empty slabs, "
+                 << static_cast<int>(stats.fragmentation * 100.0 + 0.5) << "% unused, "
+                 << stats.bytesReserved / 1024 << " KiB reserved");
+    }
+}
+
+void PlantPool::setThreadCaching(bool enabled) {
+    threadCaching.store(enabled);
+}
+
+bool PlantPool::isThreadCaching() {
+    return threadCaching.load();
+}
@@ -0,0 +1,157 @@
+#ifndef PLANTPOOL_H
+#define PLANTPOOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Slab allocator for the objects of one concrete plant class
+ *
+ * Each species (Rose, Cactus, ...) routes its class-level operator new and
+ * operator delete here, so factories, clone() and plain new/delete all draw
+ * fixed-size blocks from slabs of OBJECTS_PER_SLAB objects instead of going
+ * to the general heap one plant at a time.
+ *
+ * Freed blocks go onto an intrusive free list. With thread caching enabled,
+ * each thread keeps a small private list per pool and only takes the pool
+ * lock to move a batch of blocks in or out.
+ *
+ * releaseAll() destroys every live object and frees all slabs in one pass,
+ * for tearing down a whole greenhouse at once. It must not race with other
+ * threads using the pool, and pointers to the released plants become invalid.
+ *
+ * Pools live for the whole program (they are never destroyed), so plants can
+ * safely be deleted during static destruction.
+ */
+class PlantPool {
+public:
+    static constexpr size_t OBJECTS_PER_SLAB = 256;
+
+    /**
+     * @brief Snapshot of a pool's occupancy
+     */
+    struct Stats {
+        std::string name;
+        size_t objectSize;
+        size_t liveObjects;       // Allocated and not yet freed
+        size_t peakLiveObjects;
+        size_t totalAllocations;
+        size_t slabCount;
+        size_t capacity;          // Blocks across all slabs
+        size_t emptySlabs;        // Slabs with no live object
+        size_t bytesReserved;
+        double fragmentation;     // Share of reserved blocks not in use (0 = fully packed)
+    };
+
+private:
+    struct Slab {
+        Slab* next;
+        size_t capacity;               // Blocks in this slab
+    };
+
+    std::string name;
+    size_t objectSize;
+    size_t blockSize;                  // Header + object, 16-byte aligned
+    void (*destroy)(void* object);     // Runs the concrete destructor (releaseAll)
+    size_t id;                         // Index into the per-thread caches
+
+    mutable std::mutex mutex;
+    Slab* slabs;
+    size_t slabCount;
+    size_t blockCount;                 // Blocks across all slabs
+    void* freeList;
+    std::atomic<size_t> live;
+    std::atomic<size_t> peakLive;
+    std::atomic<size_t> allocations;
+    std::atomic<uint64_t> epoch;       // Bumped by releaseAll() to invalidate thread caches
+
+    static std::atomic<bool> threadCaching;
+
+    Slab* carveSlab(size_t capacity);  // Requires mutex
+    void noteAllocated(size_t count);
+    void* popLocked();                 // Requires mutex
+
+    friend struct PlantPoolThreadCache;
+
+public:
+    /**
+     * @param poolName Name used in statistics (usually the plant type)
+     * @param size sizeof the concrete class
+     * @param destroyObject Calls the concrete destructor without freeing
+     */
+    PlantPool(const std::string& poolName, size_t size, void (*destroyObject)(void*));
+    ~PlantPool();
+
+    PlantPool(const PlantPool&) = delete;
+    PlantPool& operator=(const PlantPool&) = delete;
+
+    /**
+     * @brief Block for one object (requests of another size fall back to ::operator new)
+     */
+    void* allocate(size_t size);
+
+    /**
+     * @brief Return a block obtained from allocate() with the same size
+     */
+    void deallocate(void* object, size_t size);
+
+    /**
+     * @brief Contiguous run of live blocks from a slab of its own
+     *
+     * Object i starts at (unsigned char*)first + i * getBlockStride(). Each
+     * object is freed individually through deallocate() like any other.
+     *
+     * @return First object (nullptr if count is 0)
+     */
+    void* allocateRun(size_t count);
+
+    /**
+     * @brief Distance in bytes between consecutive objects of a run
+     */
+    size_t getBlockStride() const;
+
+    /**
+     * @brief Destroy every live object and free all slabs
+     * @return Number of objects destroyed
+     */
+    size_t releaseAll();
+
+    Stats getStats() const;
+
+    // ========== POOL REGISTRY ==========
+
+    /**
+     * @brief Pool for a concrete plant class (created on first use, never destroyed)
+     */
+    template <typename T>
+    static PlantPool& forType(const char* poolName) {
+        static PlantPool* pool = new PlantPool(poolName, sizeof(T),
+                                               [](void* object) { static_cast<T*>(object)->~T(); });
+        return *pool;
+    }
+
+    static std::vector<PlantPool*> getPools();
+
+    /**
+     * @brief releaseAll() on every pool
+     * @return Number of objects destroyed
+     */
+    static size_t releaseAllPools();
+
+    /**
+     * @brief Log the statistics of every pool
+     */
+    static void reportStats();
+
+    /**
+     * @brief Enable per-thread free-list caches (off by default)
+     */
+    static void setThreadCaching(bool enabled);
+    static bool isThreadCaching();
+};
+
+#endif // PLANTPOOL_H
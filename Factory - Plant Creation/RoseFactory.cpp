@@ -1,15 +1,34 @@
 #include "RoseFactory.h"
+#include "PlantPool.h"
+#include "../Flyweight - Species Traits/SpeciesRegistry.h"
 #include <iostream>
+#include <new>
 
-Rose::Rose() : Plant("Rose", 45)
+static const SpeciesTraits* roseTraits()
+{
+    static const SpeciesTraits* traits = SpeciesRegistry::getInstance().intern(
+        SpeciesTraits("Rose", "Rosa rubiginosa", "loamy", "spring", 3, 6, 14, 45, 5.0, 45.00));
+    return traits;
+}
+
+Rose::Rose() : Plant(roseTraits())
 {
-    initialize();
 }
 
 Rose::Rose(const Rose &other) : Plant(other) {}
 
 Rose::~Rose() {}
 
+void *Rose::operator new(size_t size)
+{
+    return PlantPool::forType<Rose>("Rose").allocate(size);
+}
+
+void Rose::operator delete(void *object, size_t size)
+{
+    PlantPool::forType<Rose>("Rose").deallocate(object, size);
+}
+
 Plant *Rose::clone() const
 {
     return new Rose(*this);
@@ -22,15 +41,7 @@ std::string Rose::getType() const
 
 void Rose::initialize()
 {
-    setScientificName("Rosa rubiginosa");
-    setHeight(5.0);
-    setBasePrice(45.00);
-    setWateringFrequency(3);
-    setSunlightRequirement(6);
-    setFertilizingFrequency(14);
-    setSoilType("loamy");
-    setHealthLevel(100);
-    setCurrentSeason("spring");
+    applySpeciesDefaults();
 }
 
 void Rose::display() const
@@ -45,6 +56,12 @@ Plant* RoseFactory::createPlant()
     return new Rose();
 }
 
+size_t RoseFactory::createPlants(size_t count, std::vector<Plant *> &out)
+{
+    return createBlock(count, out, PlantPool::forType<Rose>("Rose"), roseTraits(),
+                       [](void *block) -> Plant * { return ::new (block) Rose(); });
+}
+
 std::string RoseFactory::getPlantType() const
 {
     return "Rose";
@@ -11,6 +11,10 @@ public:
     Rose(const Rose &other);
     ~Rose() override;
 
+    // Instances come from the Rose slab pool (see PlantPool)
+    static void *operator new(size_t size);
+    static void operator delete(void *object, size_t size);
+
     Plant *clone() const override;
     std::string getType() const override;
     void initialize() override;
@@ -22,6 +26,7 @@ class RoseFactory : public PlantFactory
 public:
     virtual ~RoseFactory() = default;
     Plant *createPlant() override;
+    size_t createPlants(size_t count, std::vector<Plant *> &out) override;
     std::string getPlantType() const override;
 };
 
@@ -1,15 +1,34 @@
 #include "SucculentFactory.h"
+#include "PlantPool.h"
+#include "../Flyweight - Species Traits/SpeciesRegistry.h"
 #include <iostream>
+#include <new>
 
-Succulent::Succulent() : Plant("Succulent", 40)
+static const SpeciesTraits* succulentTraits()
+{
+    static const SpeciesTraits* traits = SpeciesRegistry::getInstance().intern(
+        SpeciesTraits("Succulent", "Crassulaceae", "sandy", "summer", 10, 6, 45, 40, 2.5, 20.00));
+    return traits;
+}
+
+Succulent::Succulent() : Plant(succulentTraits())
 {
-    initialize();
 }
 
 Succulent::Succulent(const Succulent &other) : Plant(other) {}
 
 Succulent::~Succulent() {}
 
+void *Succulent::operator new(size_t size)
+{
+    return PlantPool::forType<Succulent>("Succulent").allocate(size);
+}
+
+void Succulent::operator delete(void *object, size_t size)
+{
+    PlantPool::forType<Succulent>("Succulent").deallocate(object, size);
+}
+
 Plant *Succulent::clone() const
 {
     return new Succulent(*this);
@@ -22,15 +41,7 @@ std::string Succulent::getType() const
 
 void Succulent::initialize()
 {
-    setScientificName("Crassulaceae");
-    setHeight(2.5);
-    setBasePrice(20.00);
-    setWateringFrequency(10);
-    setSunlightRequirement(6);
-    setFertilizingFrequency(45);
-    setSoilType("sandy");
-    setHealthLevel(100);
-    setCurrentSeason("summer");
+    applySpeciesDefaults();
 }
 
 void Succulent::display() const
@@ -45,6 +56,12 @@ Plant* SucculentFactory::createPlant()
     return new Succulent();
 }
 
+size_t SucculentFactory::createPlants(size_t count, std::vector<Plant *> &out)
+{
+    return createBlock(count, out, PlantPool::forType<Succulent>("Succulent"), succulentTraits(),
+                       [](void *block) -> Plant * { return ::new (block) Succulent(); });
+}
+
 std::string SucculentFactory::getPlantType() const
 {
     return "Succulent";
@@ -10,6 +10,10 @@ public:
     Succulent(const Succulent &other);
     ~Succulent() override;
 
+    // Instances come from the Succulent slab pool (see PlantPool)
+    static void *operator new(size_t size);
+    static void operator delete(void *object, size_t size);
+
     Plant *clone() const override;
     std::string getType() const override;
     void initialize() override;
@@ -21,6 +25,7 @@ class SucculentFactory : public PlantFactory
 public:
     virtual ~SucculentFactory() = default;
     Plant *createPlant() override;
+    size_t createPlants(size_t count, std::vector<Plant *> &out) override;
     std::string getPlantType() const override;
 };
 
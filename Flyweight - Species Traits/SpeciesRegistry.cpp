@@ -0,0 +1,37 @@
+#include "SpeciesRegistry.h"
+
+SpeciesRegistry& SpeciesRegistry::getInstance() {
+    static SpeciesRegistry instance;
+    return instance;
+}
+
+const SpeciesTraits* SpeciesRegistry::intern(const SpeciesTraits& traits) {
+    std::string key = traits.key();
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = traitsByKey.find(key);
+    if (it != traitsByKey.end()) {
+        return it->second.get();
+    }
+    std::unique_ptr<const SpeciesTraits> created(new SpeciesTraits(traits));
+    const SpeciesTraits* shared = created.get();
+    traitsByKey.emplace(key, std::move(created));
+    speciesByName.emplace(traits.getSpecies(), shared);   // Keeps the first registration
+    return shared;
+}
+
+const SpeciesTraits* SpeciesRegistry::find(const std::string& species) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = speciesByName.find(species);
+    return it != speciesByName.end() ? it->second : nullptr;
+}
+
+const SpeciesTraits* SpeciesRegistry::getDefault() {
+    static const SpeciesTraits* defaults = intern(SpeciesTraits());
+    return defaults;
+}
+
+size_t SpeciesRegistry::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return traitsByKey.size();
+}
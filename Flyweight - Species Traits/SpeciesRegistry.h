@@ -0,0 +1,53 @@
+#ifndef SPECIESREGISTRY_H
+#define SPECIESREGISTRY_H
+
+#include "SpeciesTraits.h"
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief Flyweight factory that interns SpeciesTraits
+ *
+ * Equal traits are stored once and live for the rest of the program, so the
+ * returned pointers can be held by any number of plants.
+ */
+class SpeciesRegistry {
+private:
+    std::map<std::string, std::unique_ptr<const SpeciesTraits>> traitsByKey;
+    std::map<std::string, const SpeciesTraits*> speciesByName;   // First registration of each species
+    mutable std::mutex mutex;
+
+    SpeciesRegistry() = default;
+
+public:
+    SpeciesRegistry(const SpeciesRegistry&) = delete;
+    SpeciesRegistry& operator=(const SpeciesRegistry&) = delete;
+
+    static SpeciesRegistry& getInstance();
+
+    /**
+     * @brief Shared instance equal to the given traits (created on first use)
+     */
+    const SpeciesTraits* intern(const SpeciesTraits& traits);
+
+    /**
+     * @brief Traits registered for a species name
+     * @return nullptr if no plant of that species has been registered
+     */
+    const SpeciesTraits* find(const std::string& species) const;
+
+    /**
+     * @brief Traits for plants created without a species ("Unknown", Plant() defaults)
+     */
+    const SpeciesTraits* getDefault();
+
+    /**
+     * @brief Number of distinct interned traits (species plus override variants)
+     */
+    size_t size() const;
+};
+
+#endif // SPECIESREGISTRY_H
@@ -0,0 +1,65 @@
+#include "SpeciesTraits.h"
+#include <sstream>
+
+SpeciesTraits::SpeciesTraits(const std::string& spec, const std::string& sciName,
+                             const std::string& soil, const std::string& seasonName,
+                             int watering, int sunlight, int fertilizing, int maturity,
+                             double height, double price)
+    : species(spec), scientificName(sciName), soilType(soil), season(seasonName),
+      wateringFrequency(watering), sunlightRequirement(sunlight),
+      fertilizingFrequency(fertilizing), daysToMaturity(maturity),
+      initialHeight(height), basePrice(price) {
+}
+
+const std::string& SpeciesTraits::getSpecies() const { return species; }
+const std::string& SpeciesTraits::getScientificName() const { return scientificName; }
+const std::string& SpeciesTraits::getSoilType() const { return soilType; }
+const std::string& SpeciesTraits::getSeason() const { return season; }
+
+int SpeciesTraits::getWateringFrequency() const { return wateringFrequency; }
+int SpeciesTraits::getSunlightRequirement() const { return sunlightRequirement; }
+int SpeciesTraits::getFertilizingFrequency() const { return fertilizingFrequency; }
+int SpeciesTraits::getDaysToMaturity() const { return daysToMaturity; }
+double SpeciesTraits::getInitialHeight() const { return initialHeight; }
+double SpeciesTraits::getBasePrice() const { return basePrice; }
+
+SpeciesTraits SpeciesTraits::withSpecies(const std::string& value) const {
+    SpeciesTraits copy(*this);
+    copy.species = value;
+    return copy;
+}
+
+SpeciesTraits SpeciesTraits::withScientificName(const std::string& value) const {
+    SpeciesTraits copy(*this);
+    copy.scientificName = value;
+    return copy;
+}
+
+SpeciesTraits SpeciesTraits::withSoilType(const std::string& value) const {
+    SpeciesTraits copy(*this);
+    copy.soilType = value;
+    return copy;
+}
+
+SpeciesTraits SpeciesTraits::withSeason(const std::string& value) const {
+    SpeciesTraits copy(*this);
+    copy.season = value;
+    return copy;
+}
+
+SpeciesTraits SpeciesTraits::withDaysToMaturity(int value) const {
+    SpeciesTraits copy(*this);
+    copy.daysToMaturity = value;
+    return copy;
+}
+
+std::string SpeciesTraits::key() const {
+    // Unit separator keeps field boundaries unambiguous
+    const char sep = '\x1f';
+    std::ostringstream oss;
+    oss.precision(17);
+    oss << species << sep << scientificName << sep << soilType << sep << season << sep
+        << wateringFrequency << sep << sunlightRequirement << sep << fertilizingFrequency << sep
+        << daysToMaturity << sep << initialHeight << sep << basePrice;
+    return oss.str();
+}
@@ -0,0 +1,66 @@
+#ifndef SPECIESTRAITS_H
+#define SPECIESTRAITS_H
+
+#include <string>
+
+/**
+ * @brief Immutable description of a plant species (Flyweight)
+ *
+ * Holds the identity strings and care defaults that every plant of a species
+ * shares. Plants keep a pointer to one interned instance from the
+ * SpeciesRegistry instead of their own copies; a per-plant override interns a
+ * variant with the changed field, so the shared instance is never modified.
+ */
+class SpeciesTraits {
+private:
+    std::string species;
+    std::string scientificName;
+    std::string soilType;
+    std::string season;
+    int wateringFrequency;
+    int sunlightRequirement;
+    int fertilizingFrequency;
+    int daysToMaturity;
+    double initialHeight;
+    double basePrice;
+
+public:
+    SpeciesTraits(const std::string& species = "Unknown",
+                  const std::string& scientificName = "",
+                  const std::string& soilType = "loamy",
+                  const std::string& season = "spring",
+                  int wateringFrequency = 7,
+                  int sunlightRequirement = 6,
+                  int fertilizingFrequency = 30,
+                  int daysToMaturity = 60,
+                  double initialHeight = 0.0,
+                  double basePrice = 0.0);
+
+    // ========== SHARED ATTRIBUTES ==========
+    const std::string& getSpecies() const;
+    const std::string& getScientificName() const;
+    const std::string& getSoilType() const;
+    const std::string& getSeason() const;
+
+    // ========== CARE DEFAULTS (copied into a plant's store slot on creation) ==========
+    int getWateringFrequency() const;
+    int getSunlightRequirement() const;
+    int getFertilizingFrequency() const;
+    int getDaysToMaturity() const;
+    double getInitialHeight() const;
+    double getBasePrice() const;
+
+    // ========== VARIANTS (for per-plant overrides) ==========
+    SpeciesTraits withSpecies(const std::string& value) const;
+    SpeciesTraits withScientificName(const std::string& value) const;
+    SpeciesTraits withSoilType(const std::string& value) const;
+    SpeciesTraits withSeason(const std::string& value) const;
+    SpeciesTraits withDaysToMaturity(int value) const;
+
+    /**
+     * @brief Identity used by the registry to intern equal traits once
+     */
+    std::string key() const;
+};
+
+#endif // SPECIESTRAITS_H
@@ -0,0 +1,131 @@
+#include "ConcurrentInventory.h"
+#include "ConcurrentInventoryIterator.h"
+#include <thread>
+
+ConcurrentInventory::ConcurrentInventory()
+    : current(new Publication{std::make_shared<const Snapshot>()}), readerPhase(0) {
+    readers[0].active = 0;
+    readers[1].active = 0;
+}
+
+ConcurrentInventory::~ConcurrentInventory() {
+    // Note: We don't delete plants here - ownership remains with creator
+    delete current.load();
+}
+
+std::shared_ptr<const ConcurrentInventory::Snapshot> ConcurrentInventory::snapshot() const {
+    // Announce ourselves so the publication is not retired while we copy the reference
+    ReaderCount& count = readers[readerPhase.load() & 1];
+    count.active.fetch_add(1);
+    std::shared_ptr<const Snapshot> view = current.load()->snapshot;
+    count.active.fetch_sub(1);
+    return view;
+}
+
+PlantIterator* ConcurrentInventory::createIterator() {
+    return new ConcurrentInventoryIterator(snapshot());
+}
+
+// ========== WRITERS ==========
+
+ConcurrentInventory::Snapshot::Chunk& ConcurrentInventory::writable(Snapshot& next, size_t chunk) {
+    // A chunk also referenced by the published snapshot is copied before writing;
+    // one created during this write is only referenced by 'next'
+    if (next.chunks[chunk].use_count() > 1) {
+        next.chunks[chunk] = std::make_shared<Snapshot::Chunk>(*next.chunks[chunk]);
+    }
+    return *next.chunks[chunk];
+}
+
+void ConcurrentInventory::appendLocked(Snapshot& next, Plant* plant) {
+    if (next.count % CHUNK_SIZE == 0) {
+        next.chunks.push_back(std::make_shared<Snapshot::Chunk>());
+        next.chunks.back()->reserve(CHUNK_SIZE);
+    }
+    writable(next, next.chunks.size() - 1).push_back(plant);
+    positionOf.assign(plant, next.count);
+    next.count++;
+}
+
+void ConcurrentInventory::publish(std::shared_ptr<Snapshot> next) {
+    next->version++;
+    const Publication* previous = current.exchange(new Publication{std::move(next)});
+    waitForReaders();
+    delete previous;   // Readers that took the old snapshot keep their own reference
+}
+
+void ConcurrentInventory::waitForReaders() {
+    // Send new readers to the other counter, then wait for this one to drain;
+    // after both have drained, no reader can still be reading the old publication
+    for (int phase = 0; phase < 2; phase++) {
+        ReaderCount& draining = readers[readerPhase.fetch_add(1) & 1];
+        while (draining.active.load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void ConcurrentInventory::addPlant(Plant* plant) {
+    if (!plant) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (positionOf.find(plant) != OpenAddressIndex<const Plant*>::NPOS) {
+        return;
+    }
+    std::shared_ptr<Snapshot> next = std::make_shared<Snapshot>(*current.load()->snapshot);
+    appendLocked(*next, plant);
+    publish(std::move(next));
+}
+
+void ConcurrentInventory::addPlants(const std::vector<Plant*>& batch) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    std::shared_ptr<Snapshot> next = std::make_shared<Snapshot>(*current.load()->snapshot);
+    size_t added = 0;
+    for (Plant* plant : batch) {
+        if (plant && positionOf.find(plant) == OpenAddressIndex<const Plant*>::NPOS) {
+            appendLocked(*next, plant);
+            added++;
+        }
+    }
+    if (added > 0) {
+        publish(std::move(next));
+    }
+}
+
+void ConcurrentInventory::removePlant(Plant* plant) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    size_t index = positionOf.find(plant);
+    if (index == OpenAddressIndex<const Plant*>::NPOS) {
+        return;
+    }
+    positionOf.erase(plant);
+
+    std::shared_ptr<Snapshot> next = std::make_shared<Snapshot>(*current.load()->snapshot);
+    const size_t last = next->count - 1;
+    const size_t lastChunk = last / CHUNK_SIZE;
+
+    // Swap-remove: copy the chunks being written, leave the rest shared
+    Snapshot::Chunk& tail = writable(*next, lastChunk);
+    Plant* moved = tail.back();
+    tail.pop_back();
+    if (index != last) {
+        writable(*next, index / CHUNK_SIZE)[index % CHUNK_SIZE] = moved;
+        positionOf.assign(moved, index);
+    }
+    if (tail.empty()) {
+        next->chunks.pop_back();
+    }
+    next->count--;
+    publish(std::move(next));
+}
+
+// ========== READERS ==========
+
+bool ConcurrentInventory::isEmpty() const {
+    return snapshot()->empty();
+}
+
+size_t ConcurrentInventory::getCount() const {
+    return snapshot()->size();
+}
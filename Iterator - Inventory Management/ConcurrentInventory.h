@@ -0,0 +1,176 @@
+#ifndef CONCURRENTINVENTORY_H
+#define CONCURRENTINVENTORY_H
+#include "PlantCollection.h"
+#include "OpenAddressIndex.h"
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Plant;
+class PlantIterator;
+
+/**
+ * @brief Plant collection that can be read from many threads while it is being changed
+ *
+ * The contents are published as immutable Snapshots (read-copy-update).
+ * Readers - iterators, reports, browsing - take a reference to the current
+ * snapshot with a few atomic operations and no lock, so they never wait for
+ * a writer and always see a consistent state. A reader's snapshot stays
+ * valid for as long as it holds it; old snapshots are freed when the last
+ * reader lets go.
+ *
+ * Writers (addPlant, removePlant, addPlants) are serialised by a mutex. Each
+ * write builds the next snapshot, publishes it with one atomic exchange and
+ * then waits out a grace period: readers still taking a reference to the
+ * previous snapshot are counted in two alternating reader counters, and the
+ * writer retires the old publication only once both have drained.
+ * Plants are stored in fixed-size chunks shared between snapshots, so a
+ * write copies the chunk table and the one or two chunks it touches rather
+ * than the whole collection.
+ *
+ * Like GreenhouseInventory, removal swaps the last plant into the gap.
+ */
+class ConcurrentInventory : public PlantCollection {
+public:
+    static constexpr size_t CHUNK_SIZE = 1024;
+
+    /**
+     * @brief Immutable view of the collection at one point in time
+     */
+    class Snapshot {
+    private:
+        typedef std::vector<Plant*> Chunk;
+        std::vector<std::shared_ptr<Chunk>> chunks;     // Never modified once published
+        size_t count;
+        uint64_t version;
+
+        friend class ConcurrentInventory;
+
+    public:
+        /**
+         * @brief Random-access iterator, so snapshots work with <algorithm> and <ranges>
+         */
+        class const_iterator {
+        private:
+            const Snapshot* owner;
+            size_t index;
+
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef Plant* value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Plant* const* pointer;
+            typedef Plant* reference;
+
+            const_iterator() : owner(nullptr), index(0) {}
+            const_iterator(const Snapshot* snapshot, size_t position) : owner(snapshot), index(position) {}
+
+            Plant* operator*() const { return owner->at(index); }
+            Plant* operator[](difference_type n) const { return owner->at(index + n); }
+
+            const_iterator& operator++() { ++index; return *this; }
+            const_iterator operator++(int) { const_iterator old = *this; ++index; return old; }
+            const_iterator& operator--() { --index; return *this; }
+            const_iterator operator--(int) { const_iterator old = *this; --index; return old; }
+            const_iterator& operator+=(difference_type n) { index += n; return *this; }
+            const_iterator& operator-=(difference_type n) { index -= n; return *this; }
+
+            friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+            friend const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+            friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+            friend difference_type operator-(const const_iterator& a, const const_iterator& b) {
+                return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+            }
+            friend bool operator==(const const_iterator& a, const const_iterator& b) {
+                return a.index == b.index;
+            }
+            friend std::strong_ordering operator<=>(const const_iterator& a, const const_iterator& b) {
+                return a.index <=> b.index;
+            }
+        };
+
+        Snapshot() : count(0), version(0) {}
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, count); }
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        /**
+         * @brief Number of writes published before this snapshot
+         */
+        uint64_t getVersion() const { return version; }
+
+        Plant* at(size_t index) const {
+            return (*chunks[index / CHUNK_SIZE])[index % CHUNK_SIZE];
+        }
+
+        /**
+         * @brief Call visit(plant) for every plant, in order
+         */
+        template <typename Visitor>
+        void forEach(Visitor visit) const {
+            for (const std::shared_ptr<Chunk>& chunk : chunks) {
+                for (Plant* plant : *chunk) {
+                    visit(plant);
+                }
+            }
+        }
+    };
+
+private:
+    struct Publication {
+        std::shared_ptr<const Snapshot> snapshot;
+    };
+
+    // Reader side
+    std::atomic<const Publication*> current;
+    std::atomic<uint64_t> readerPhase;                   // Selects the counter new readers use
+    struct alignas(64) ReaderCount {
+        std::atomic<size_t> active;
+    };
+    mutable ReaderCount readers[2];
+
+    // Writer side (guarded by writeMutex)
+    std::mutex writeMutex;
+    OpenAddressIndex<const Plant*> positionOf;   // Plant -> index in the latest snapshot
+
+    Snapshot::Chunk& writable(Snapshot& next, size_t chunk);
+    void appendLocked(Snapshot& next, Plant* plant);
+    void publish(std::shared_ptr<Snapshot> next);
+    void waitForReaders();                       // Grace period after a publish
+
+public:
+    ConcurrentInventory();
+    virtual ~ConcurrentInventory();
+
+    ConcurrentInventory(const ConcurrentInventory&) = delete;
+    ConcurrentInventory& operator=(const ConcurrentInventory&) = delete;
+
+    /**
+     * @brief Current contents (never blocks on writers)
+     */
+    std::shared_ptr<const Snapshot> snapshot() const;
+
+    /**
+     * @brief Iterator over the snapshot current at creation
+     */
+    PlantIterator* createIterator() override;
+    void addPlant(Plant* plant) override;      // Ignored if the plant is already present
+    void removePlant(Plant* plant) override;
+    bool isEmpty() const override;
+    size_t getCount() const;
+
+    /**
+     * @brief Add several plants as one write (readers see all of them or none)
+     */
+    void addPlants(const std::vector<Plant*>& batch);
+};
+
+#endif // CONCURRENTINVENTORY_H
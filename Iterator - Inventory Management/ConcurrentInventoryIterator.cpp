@@ -0,0 +1,28 @@
+#include "ConcurrentInventoryIterator.h"
+#include <utility>
+
+ConcurrentInventoryIterator::ConcurrentInventoryIterator(
+    std::shared_ptr<const ConcurrentInventory::Snapshot> view)
+    : snapshot(std::move(view)), currentIndex(0) {
+}
+
+void ConcurrentInventoryIterator::first() {
+    currentIndex = 0;
+}
+
+void ConcurrentInventoryIterator::next() {
+    if (!isDone()) {
+        currentIndex++;
+    }
+}
+
+bool ConcurrentInventoryIterator::isDone() const {
+    return currentIndex >= snapshot->size();
+}
+
+Plant* ConcurrentInventoryIterator::currentItem() const {
+    if (isDone()) {
+        return nullptr;
+    }
+    return snapshot->at(currentIndex);
+}
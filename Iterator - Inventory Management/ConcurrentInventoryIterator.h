@@ -0,0 +1,28 @@
+#ifndef CONCURRENTINVENTORYITERATOR_H
+#define CONCURRENTINVENTORYITERATOR_H
+#include "PlantIterator.h"
+#include "ConcurrentInventory.h"
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Iterator over one ConcurrentInventory snapshot
+ *
+ * Holds the snapshot it was created from, so it sees a consistent collection
+ * however many writes happen during the iteration, and never takes a lock.
+ */
+class ConcurrentInventoryIterator : public PlantIterator {
+private:
+    std::shared_ptr<const ConcurrentInventory::Snapshot> snapshot;
+    size_t currentIndex;
+
+public:
+    explicit ConcurrentInventoryIterator(std::shared_ptr<const ConcurrentInventory::Snapshot> view);
+    
+    void first() override;
+    void next() override;
+    bool isDone() const override;
+    Plant* currentItem() const override;
+};
+
+#endif // CONCURRENTINVENTORYITERATOR_H
@@ -1,12 +1,18 @@
 #include "GreenhouseInventory.h"
 #include "InventoryIterator.h"
 #include "../Plant - Abstract Base/Plant.h"
-#include <algorithm>
+#include "../Plant - Abstract Base/PlantStore.h"
+#include <memory>
 
-GreenhouseInventory::GreenhouseInventory() {
+GreenhouseInventory::GreenhouseInventory() : version(0), liveIterators(nullptr) {
 }
 
 GreenhouseInventory::~GreenhouseInventory() {
+    // Iterators that outlive the inventory keep their view
+    beforeChange();
+    for (PlantStore* store : observedStores) {
+        store->removeObserver(this);
+    }
     // Note: We don't delete plants here - ownership remains with creator
     plants.clear();
 }
@@ -16,15 +22,40 @@ PlantIterator* GreenhouseInventory::createIterator() {
 }
 
 void GreenhouseInventory::addPlant(Plant* plant) {
-    if (plant) {
-        plants.push_back(plant);
+    if (!plant || positionOf.find(plant) != OpenAddressIndex<const Plant*>::NPOS) {
+        return;
     }
+    beforeChange();
+    positionOf.assign(plant, plants.size());
+    positionById.assign(plant->getPlantId(), plants.size());
+    plants.push_back(plant);
+    indexes.append(plant);
+    rankings.insert(plant, indexes.keysAt(plants.size() - 1));
+    observe(plant->getStore());
 }
 
 void GreenhouseInventory::removePlant(Plant* plant) {
-    auto it = std::find(plants.begin(), plants.end(), plant);
-    if (it != plants.end()) {
-        plants.erase(it);
+    size_t index = positionOf.find(plant);
+    if (index == OpenAddressIndex<const Plant*>::NPOS) {
+        return;
+    }
+    beforeChange();
+    positionOf.erase(plant);
+    if (positionById.find(plant->getPlantId()) == index) {
+        positionById.erase(plant->getPlantId());
+    }
+    rankings.erase(plant, indexes.keysAt(index));
+    indexes.removeSwapLast(index);
+
+    // Swap-remove: the last plant takes over the freed position
+    Plant* last = plants.back();
+    plants.pop_back();
+    if (last != plant) {
+        plants[index] = last;
+        positionOf.assign(last, index);
+        if (positionById.find(last->getPlantId()) == plants.size()) {
+            positionById.assign(last->getPlantId(), index);
+        }
     }
 }
 
@@ -42,3 +73,171 @@ Plant* GreenhouseInventory::getPlantAt(size_t index) const {
     }
     return nullptr;
 }
+
+GreenhouseInventory::const_iterator GreenhouseInventory::begin() const {
+    return plants.begin();
+}
+
+GreenhouseInventory::const_iterator GreenhouseInventory::end() const {
+    return plants.end();
+}
+
+size_t GreenhouseInventory::size() const {
+    return plants.size();
+}
+
+Plant* GreenhouseInventory::findById(int id) const {
+    size_t index = positionById.find(id);
+    return index == OpenAddressIndex<int>::NPOS ? nullptr : plants[index];
+}
+
+bool GreenhouseInventory::contains(const Plant* plant) const {
+    return positionOf.find(plant) != OpenAddressIndex<const Plant*>::NPOS;
+}
+
+// ========== SECONDARY INDEXES ==========
+
+std::vector<Plant*> GreenhouseInventory::query(const InventoryQuery& filter) const {
+    std::vector<size_t> positions = indexes.match(filter, plants);
+    std::vector<Plant*> result;
+    result.reserve(positions.size());
+    for (size_t position : positions) {
+        result.push_back(plants[position]);
+    }
+    return result;
+}
+
+size_t GreenhouseInventory::countMatching(const InventoryQuery& filter) const {
+    return indexes.match(filter, plants).size();
+}
+
+// ========== RANKING ==========
+
+std::vector<Plant*> GreenhouseInventory::topK(PlantRank rank, size_t k, bool highestFirst,
+                                              const InventoryQuery& filter) const {
+    InventoryRanking::Entry last;
+    return rankedPage(rank, highestFirst, filter, k, nullptr, last);
+}
+
+RankingCursor GreenhouseInventory::rankCursor(PlantRank rank, bool highestFirst,
+                                              const InventoryQuery& filter) const {
+    return RankingCursor(this, rank, highestFirst, filter);
+}
+
+std::vector<Plant*> GreenhouseInventory::rankedPage(PlantRank rank, bool highestFirst,
+                                                    const InventoryQuery& filter, size_t count,
+                                                    const InventoryRanking::Entry* after,
+                                                    InventoryRanking::Entry& last) const {
+    rankings.ensureBuilt(rank, plants, indexes);
+    return rankings.collect(rank, highestFirst, filter, indexes, count, after, last);
+}
+
+InventoryTotals GreenhouseInventory::getTotals() const {
+    return indexes.getTotals();
+}
+
+InventoryTotals GreenhouseInventory::getReadinessTotals(bool ready) const {
+    return indexes.getReadinessTotals(ready);
+}
+
+InventoryTotals GreenhouseInventory::getSpeciesTotals(const std::string& species) const {
+    return indexes.getSpeciesTotals(species);
+}
+
+InventoryTotals GreenhouseInventory::getSpeciesTotals(const std::string& species, bool ready) const {
+    return indexes.getSpeciesTotals(species, ready);
+}
+
+const std::vector<std::string>& GreenhouseInventory::getSpeciesNames() const {
+    return indexes.getSpeciesNames();
+}
+
+void GreenhouseInventory::observe(PlantStore* store) {
+    for (PlantStore* observed : observedStores) {
+        if (observed == store) {
+            return;
+        }
+    }
+    store->addObserver(this);
+    observedStores.push_back(store);
+}
+
+void GreenhouseInventory::reindex(size_t position) {
+    Plant* plant = plants[position];
+    InventoryIndex::Keys before = indexes.refresh(position, plant);
+    rankings.update(plant, before, indexes.keysAt(position));
+    int oldId = before.plantId;
+    int newId = plant->getPlantId();
+    if (oldId != newId) {
+        if (positionById.find(oldId) == position) {
+            positionById.erase(oldId);
+        }
+        positionById.assign(newId, position);
+    }
+}
+
+void GreenhouseInventory::plantChanged(Plant* plant) {
+    size_t index = positionOf.find(plant);
+    if (index != OpenAddressIndex<const Plant*>::NPOS) {
+        reindex(index);
+    }
+}
+
+void GreenhouseInventory::storeTicked() {
+    for (size_t i = 0; i < plants.size(); i++) {
+        reindex(i);
+    }
+}
+
+void GreenhouseInventory::plantReleased(Plant* plant) {
+    removePlant(plant);
+}
+
+uint64_t GreenhouseInventory::getVersion() const {
+    return version;
+}
+
+// ========== LIVE ITERATORS ==========
+
+void GreenhouseInventory::registerIterator(InventoryIterator* iterator) {
+    iterator->prevLive = nullptr;
+    iterator->nextLive = liveIterators;
+    if (liveIterators) {
+        liveIterators->prevLive = iterator;
+    }
+    liveIterators = iterator;
+}
+
+void GreenhouseInventory::unregisterIterator(InventoryIterator* iterator) {
+    if (iterator->prevLive) {
+        iterator->prevLive->nextLive = iterator->nextLive;
+    } else {
+        liveIterators = iterator->nextLive;
+    }
+    if (iterator->nextLive) {
+        iterator->nextLive->prevLive = iterator->prevLive;
+    }
+}
+
+void GreenhouseInventory::beforeChange() {
+    if (liveIterators) {
+        // Snapshot-on-write: one copy, shared by every iterator still reading in place
+        std::shared_ptr<const std::vector<Plant*>> contents =
+            std::make_shared<const std::vector<Plant*>>(plants);
+        InventoryIterator* iterator = liveIterators;
+        while (iterator) {
+            InventoryIterator* next = iterator->nextLive;
+            iterator->detach(contents);
+            iterator = next;
+        }
+        liveIterators = nullptr;
+    }
+    version++;
+}
+
+void GreenhouseInventory::reserve(size_t count) {
+    plants.reserve(count);
+    indexes.reserve(count);
+    positionOf.reserve(count);
+    positionById.reserve(count);
+}
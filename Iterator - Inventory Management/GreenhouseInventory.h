@@ -1,27 +1,154 @@
 #ifndef GREENHOUSEINVENTORY_H
 #define GREENHOUSEINVENTORY_H
 #include "PlantCollection.h"
+#include "OpenAddressIndex.h"
+#include "InventoryIndex.h"
+#include "InventoryRanking.h"
+#include "RankingCursor.h"
+#include "../Plant - Abstract Base/PlantStoreObserver.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include <vector>
 
 class InventoryIterator;
 class Plant;
 class PlantIterator;
+class PlantStore;
 
-class GreenhouseInventory : public PlantCollection {
+/**
+ * @brief Plant collection with constant-time lookup and removal
+ *
+ * Plants are kept in a dense vector. Two open-addressing indexes map each
+ * plant and each plant ID to its position, so findById(), contains() and
+ * removePlant() do not scan. Removal swaps the last plant into the gap:
+ * iteration order is insertion order, except that a removal moves the most
+ * recently added plant into the removed plant's place.
+ *
+ * Plant IDs are expected to be unique; if two plants share an ID, findById()
+ * returns the one added or renumbered last.
+ *
+ * begin()/end() expose the storage as a random-access range for the
+ * standard algorithms and the PlantViews adaptors; unlike createIterator(),
+ * such a range must not be walked while plants are added or removed.
+ *
+ * The inventory observes the PlantStore of every plant it holds, so the ID
+ * lookup and the secondary indexes behind query() (species, readiness,
+ * attention, health, price) follow setter calls, care actions and
+ * PlantStore::tickAll() without rescanning. A plant that is destroyed
+ * while held is removed automatically, so the inventory never dangles.
+ *
+ * topK() and rankCursor() rank plants by price, health or days left to
+ * maturity through ordered indexes that are built on first use and then
+ * maintained alongside the others.
+ */
+class GreenhouseInventory : public PlantCollection, public PlantStoreObserver {
 private:
     std::vector<Plant*> plants;
+    OpenAddressIndex<const Plant*> positionOf;   // Plant -> index in plants
+    OpenAddressIndex<int> positionById;          // Plant ID -> index in plants
+    InventoryIndex indexes;                      // Secondary indexes by position
+    mutable InventoryRanking rankings;           // Ordered indexes behind topK()
+    std::vector<PlantStore*> observedStores;     // Stores of the plants held
+    uint64_t version;                            // Bumped on every change
+    InventoryIterator* liveIterators;            // Iterators reading plants in place
     friend class InventoryIterator;
+    friend class RankingCursor;
+
+    void registerIterator(InventoryIterator* iterator);
+    void unregisterIterator(InventoryIterator* iterator);
+    void beforeChange();   // Hands live iterators a snapshot, then bumps the version
+    void observe(PlantStore* store);
+    void reindex(size_t position);
+    std::vector<Plant*> rankedPage(PlantRank rank, bool highestFirst, const InventoryQuery& filter,
+                                   size_t count, const InventoryRanking::Entry* after,
+                                   InventoryRanking::Entry& last) const;
 
 public:
+    typedef std::vector<Plant*>::const_iterator const_iterator;
+
     GreenhouseInventory();
     virtual ~GreenhouseInventory();
     
     PlantIterator* createIterator() override;
-    void addPlant(Plant* plant) override;
+    void addPlant(Plant* plant) override;      // Ignored if the plant is already present
     void removePlant(Plant* plant) override;
     bool isEmpty() const override;
     size_t getCount() const;
     Plant* getPlantAt(size_t index) const;
+
+    // ========== RANGE ACCESS ==========
+    const_iterator begin() const;
+    const_iterator end() const;
+    size_t size() const;
+
+    /**
+     * @brief Plant with the given ID, or nullptr
+     */
+    Plant* findById(int id) const;
+
+    bool contains(const Plant* plant) const;
+
+    /**
+     * @brief Plants matching a query, in inventory order
+     *
+     * Answered by intersecting the secondary indexes, e.g. all ready Roses
+     * with health above 80:
+     *   InventoryQuery q; q.species = "Rose"; q.readyOnly = true; q.minHealth = 81;
+     */
+    std::vector<Plant*> query(const InventoryQuery& filter) const;
+
+    /**
+     * @brief Number of plants matching a query
+     */
+    size_t countMatching(const InventoryQuery& filter) const;
+
+    // ========== RANKING ==========
+
+    /**
+     * @brief The first k plants matching a filter in rank order, in O(k log N)
+     *
+     * E.g. the ten healthiest:          topK(PlantRank::Health, 10, true)
+     *      five closest to maturity:    topK(PlantRank::Maturity, 5, false)
+     *
+     * The Maturity rank leaves out plants that are already ready for sale.
+     * Days to maturity are compared across plants of the same PlantStore.
+     * Species and readiness filters, and a range on the ranked key, keep the
+     * walk at O(k log N); attention and other ranges are checked per plant.
+     * Equal keys are ordered by plant ID.
+     *
+     * @param highestFirst Largest key first (false: smallest first)
+     */
+    std::vector<Plant*> topK(PlantRank rank, size_t k, bool highestFirst,
+                             const InventoryQuery& filter = InventoryQuery()) const;
+
+    /**
+     * @brief Cursor for paging through the whole ranking
+     */
+    RankingCursor rankCursor(PlantRank rank, bool highestFirst,
+                             const InventoryQuery& filter = InventoryQuery()) const;
+
+    // ========== RUNNING TOTALS (kept current without scanning) ==========
+    InventoryTotals getTotals() const;
+    InventoryTotals getReadinessTotals(bool ready) const;
+    InventoryTotals getSpeciesTotals(const std::string& species) const;
+    InventoryTotals getSpeciesTotals(const std::string& species, bool ready) const;
+    const std::vector<std::string>& getSpeciesNames() const;
+
+    // ========== PlantStoreObserver ==========
+    void plantChanged(Plant* plant) override;
+    void storeTicked() override;
+    void plantReleased(Plant* plant) override;
+
+    /**
+     * @brief Modification counter; changes whenever a plant is added or removed
+     */
+    uint64_t getVersion() const;
+
+    /**
+     * @brief Pre-size the storage and indexes for a known number of plants
+     */
+    void reserve(size_t count);
 };
 
 #endif // GREENHOUSEINVENTORY_H
@@ -0,0 +1,241 @@
+#include "InventoryIndex.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include "../Plant - Abstract Base/PlantStore.h"
+
+namespace {
+    uint8_t healthBucketOf(int health) {
+        if (health < 0) health = 0;
+        if (health > 100) health = 100;
+        return static_cast<uint8_t>(health / InventoryIndex::HEALTH_BUCKET_WIDTH);
+    }
+
+    uint8_t priceBucketOf(double price) {
+        if (!(price > 0.0)) {
+            return 0;
+        }
+        double bucket = price / InventoryIndex::PRICE_BUCKET_WIDTH;
+        if (bucket >= static_cast<double>(InventoryIndex::PRICE_BUCKETS - 1)) {
+            return static_cast<uint8_t>(InventoryIndex::PRICE_BUCKETS - 1);
+        }
+        return static_cast<uint8_t>(bucket);
+    }
+
+    // OR of the bucket bitmaps first..last
+    PositionBitmap bucketUnion(const PositionBitmap* buckets, size_t first, size_t last) {
+        PositionBitmap result;
+        for (size_t i = first; i <= last; i++) {
+            result.orWith(buckets[i]);
+        }
+        return result;
+    }
+}
+
+// ========== FILING ==========
+
+InventoryIndex::Keys InventoryIndex::keysFor(const Plant* plant) {
+    Keys entry;
+    entry.plantId = plant->getPlantId();
+    auto found = speciesIds.find(plant->getSpecies());
+    if (found == speciesIds.end()) {
+        found = speciesIds.emplace(plant->getSpecies(), static_cast<uint32_t>(bySpecies.size())).first;
+        bySpecies.emplace_back();
+        speciesNames.push_back(plant->getSpecies());
+        speciesTotals[0].emplace_back();
+        speciesTotals[1].emplace_back();
+    }
+    entry.species = found->second;
+    entry.health = plant->getHealthLevel();
+    entry.price = plant->getBasePrice();
+    entry.maturityDay = static_cast<int64_t>(plant->getDaysToMaturity()) -
+                        plant->getCurrentGrowthDays() + plant->getStore()->getDaysTicked();
+    entry.healthBucket = healthBucketOf(entry.health);
+    entry.priceBucket = priceBucketOf(entry.price);
+    entry.ready = plant->isReadyForSale();
+    entry.attention = plant->needsAttention();
+    return entry;
+}
+
+void InventoryIndex::file(size_t position, const Keys& entry) {
+    bySpecies[entry.species].set(position);
+    byHealth[entry.healthBucket].set(position);
+    byPrice[entry.priceBucket].set(position);
+    ready.assign(position, entry.ready);
+    attention.assign(position, entry.attention);
+}
+
+void InventoryIndex::unfile(size_t position, const Keys& entry) {
+    bySpecies[entry.species].reset(position);
+    byHealth[entry.healthBucket].reset(position);
+    byPrice[entry.priceBucket].reset(position);
+    ready.reset(position);
+    attention.reset(position);
+}
+
+void InventoryIndex::count(const Keys& entry) {
+    speciesTotals[entry.ready][entry.species].add(entry.price, entry.health);
+    readinessTotals[entry.ready].add(entry.price, entry.health);
+}
+
+void InventoryIndex::uncount(const Keys& entry) {
+    speciesTotals[entry.ready][entry.species].remove(entry.price, entry.health);
+    readinessTotals[entry.ready].remove(entry.price, entry.health);
+}
+
+// ========== MAINTENANCE ==========
+
+void InventoryIndex::append(const Plant* plant) {
+    keys.push_back(keysFor(plant));
+    file(keys.size() - 1, keys.back());
+    count(keys.back());
+}
+
+void InventoryIndex::removeSwapLast(size_t position) {
+    const size_t last = keys.size() - 1;
+    uncount(keys[position]);
+    unfile(position, keys[position]);
+    if (position != last) {
+        unfile(last, keys[last]);
+        keys[position] = keys[last];
+        file(position, keys[position]);
+    }
+    keys.pop_back();
+}
+
+InventoryIndex::Keys InventoryIndex::refresh(size_t position, const Plant* plant) {
+    Keys before = keys[position];
+    Keys after = keysFor(plant);
+    if (after.species != before.species || after.healthBucket != before.healthBucket ||
+        after.priceBucket != before.priceBucket || after.ready != before.ready ||
+        after.attention != before.attention) {
+        unfile(position, before);
+        file(position, after);
+    }
+    uncount(before);
+    count(after);
+    keys[position] = after;
+    return before;
+}
+
+const InventoryIndex::Keys& InventoryIndex::keysAt(size_t position) const {
+    return keys[position];
+}
+
+// ========== QUERIES ==========
+
+bool InventoryIndex::matches(const Plant* plant, const InventoryQuery& query) {
+    if (!query.species.empty() && plant->getSpecies() != query.species) {
+        return false;
+    }
+    if (query.readyOnly && !plant->isReadyForSale()) {
+        return false;
+    }
+    int health = plant->getHealthLevel();
+    if (health < query.minHealth || health > query.maxHealth) {
+        return false;
+    }
+    double price = plant->getBasePrice();
+    if ((query.minPrice > 0.0 && price < query.minPrice) || price > query.maxPrice) {
+        return false;
+    }
+    return !query.attentionOnly || plant->needsAttention();
+}
+
+std::vector<size_t> InventoryIndex::match(const InventoryQuery& query,
+                                          const std::vector<Plant*>& plants) const {
+    std::vector<size_t> positions;
+    if (query.minHealth > query.maxHealth || query.minPrice > query.maxPrice) {
+        return positions;
+    }
+
+    PositionBitmap candidates;
+    candidates.fill(keys.size());
+    if (!query.species.empty()) {
+        auto found = speciesIds.find(query.species);
+        if (found == speciesIds.end()) {
+            return positions;
+        }
+        candidates.andWith(bySpecies[found->second]);
+    }
+    if (query.readyOnly) {
+        candidates.andWith(ready);
+    }
+    if (query.attentionOnly) {
+        candidates.andWith(attention);
+    }
+
+    // Range filters: whole buckets by bitmap, boundary buckets plant by plant
+    const uint8_t lowHealth = healthBucketOf(query.minHealth);
+    const uint8_t highHealth = healthBucketOf(query.maxHealth);
+    const bool healthFiltered = query.minHealth > 0 || query.maxHealth < 100;
+    if (healthFiltered) {
+        candidates.andWith(bucketUnion(byHealth, lowHealth, highHealth));
+    }
+    const uint8_t lowPrice = priceBucketOf(query.minPrice);
+    const uint8_t highPrice = priceBucketOf(query.maxPrice);
+    const bool priceFiltered = query.minPrice > 0.0 ||
+                               query.maxPrice < std::numeric_limits<double>::max();
+    if (priceFiltered) {
+        candidates.andWith(bucketUnion(byPrice, lowPrice, highPrice));
+    }
+
+    positions.reserve(candidates.count());
+    candidates.forEach([&](size_t position) {
+        const Keys& entry = keys[position];
+        const Plant* plant = plants[position];
+        if (healthFiltered && (entry.healthBucket == lowHealth || entry.healthBucket == highHealth)) {
+            int health = plant->getHealthLevel();
+            if (health < query.minHealth || health > query.maxHealth) {
+                return;
+            }
+        }
+        if (priceFiltered && (entry.priceBucket == lowPrice || entry.priceBucket == highPrice)) {
+            double price = plant->getBasePrice();
+            if (price < query.minPrice || price > query.maxPrice) {
+                return;
+            }
+        }
+        positions.push_back(position);
+    });
+    return positions;
+}
+
+// ========== RUNNING TOTALS ==========
+
+InventoryTotals InventoryIndex::getTotals() const {
+    InventoryTotals totals = readinessTotals[0];
+    totals.merge(readinessTotals[1]);
+    return totals;
+}
+
+InventoryTotals InventoryIndex::getReadinessTotals(bool isReady) const {
+    return readinessTotals[isReady];
+}
+
+InventoryTotals InventoryIndex::getSpeciesTotals(const std::string& species) const {
+    InventoryTotals totals = getSpeciesTotals(species, false);
+    totals.merge(getSpeciesTotals(species, true));
+    return totals;
+}
+
+InventoryTotals InventoryIndex::getSpeciesTotals(const std::string& species, bool isReady) const {
+    auto found = speciesIds.find(species);
+    if (found == speciesIds.end()) {
+        return InventoryTotals();
+    }
+    return speciesTotals[isReady][found->second];
+}
+
+const std::vector<std::string>& InventoryIndex::getSpeciesNames() const {
+    return speciesNames;
+}
+
+uint32_t InventoryIndex::speciesIndexOf(const std::string& species) const {
+    auto found = speciesIds.find(species);
+    return found == speciesIds.end() ? NO_SPECIES : found->second;
+}
+
+void InventoryIndex::reserve(size_t capacity) {
+    keys.reserve(capacity);
+    ready.reserve(capacity);
+    attention.reserve(capacity);
+}
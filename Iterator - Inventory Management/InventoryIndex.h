@@ -0,0 +1,148 @@
+#ifndef INVENTORYINDEX_H
+#define INVENTORYINDEX_H
+#include "PositionBitmap.h"
+#include "InventoryTotals.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Plant;
+
+/**
+ * @brief Filter for GreenhouseInventory::query() (default: every plant)
+ */
+struct InventoryQuery {
+    std::string species;              // Exact species name ("" = any)
+    bool readyOnly = false;           // Only plants ready for sale
+    bool attentionOnly = false;       // Only plants that need attention
+    int minHealth = 0;                // Inclusive health range
+    int maxHealth = 100;
+    double minPrice = 0.0;            // Inclusive base price range (0 = no lower bound)
+    double maxPrice = std::numeric_limits<double>::max();
+};
+
+/**
+ * @brief Secondary indexes over the positions of a GreenhouseInventory
+ *
+ * Every indexed property is a PositionBitmap: one per species, one each for
+ * ready-for-sale and needs-attention, and one per health bucket (10 points
+ * wide) and price bucket (PRICE_BUCKET_WIDTH wide, the last one open-ended).
+ * A query ANDs the relevant bitmaps word by word; only plants in a range's
+ * boundary buckets are checked individually.
+ *
+ * The index remembers the keys it filed each position under, so refresh()
+ * can move a plant between buckets after its values change. The same keys
+ * feed running totals per species and readiness class, which are adjusted
+ * in O(1) on every append, removal and refresh.
+ */
+class InventoryIndex {
+public:
+    static constexpr int HEALTH_BUCKET_WIDTH = 10;
+    static constexpr size_t HEALTH_BUCKETS = 11;     // 0-9, ..., 90-99, 100
+    static constexpr double PRICE_BUCKET_WIDTH = 10.0;
+    static constexpr size_t PRICE_BUCKETS = 32;
+
+    /**
+     * @brief Values a position is currently filed under
+     */
+    struct Keys {
+        int plantId;
+        uint32_t species;        // Index into the species bitmaps
+        int health;
+        double price;
+        int64_t maturityDay;     // Days to maturity left + store's days ticked (tick-invariant)
+        uint8_t healthBucket;
+        uint8_t priceBucket;
+        bool ready;
+        bool attention;
+    };
+
+private:
+    std::vector<Keys> keys;                              // Per position
+    std::unordered_map<std::string, uint32_t> speciesIds;
+    std::vector<PositionBitmap> bySpecies;
+    std::vector<std::string> speciesNames;               // By species index
+    std::vector<InventoryTotals> speciesTotals[2];       // [ready][species]
+    InventoryTotals readinessTotals[2];                  // [ready]
+    PositionBitmap ready;
+    PositionBitmap attention;
+    PositionBitmap byHealth[HEALTH_BUCKETS];
+    PositionBitmap byPrice[PRICE_BUCKETS];
+
+    Keys keysFor(const Plant* plant);
+    void file(size_t position, const Keys& entry);
+    void unfile(size_t position, const Keys& entry);
+    void count(const Keys& entry);
+    void uncount(const Keys& entry);
+
+public:
+    /**
+     * @brief Index a plant newly placed at the end of the inventory
+     */
+    void append(const Plant* plant);
+
+    /**
+     * @brief Drop the last position after moving its plant into 'position' (swap-remove)
+     */
+    void removeSwapLast(size_t position);
+
+    /**
+     * @brief Re-file the plant at a position after its values changed
+     * @return Keys the position was filed under before
+     */
+    Keys refresh(size_t position, const Plant* plant);
+
+    const Keys& keysAt(size_t position) const;
+
+    /**
+     * @brief Whether a single plant satisfies a query (no index lookups)
+     */
+    static bool matches(const Plant* plant, const InventoryQuery& query);
+
+    /**
+     * @brief Positions matching a query, in increasing order
+     * @param plants Inventory storage the positions refer to (for range boundaries)
+     */
+    std::vector<size_t> match(const InventoryQuery& query, const std::vector<Plant*>& plants) const;
+
+    // ========== RUNNING TOTALS ==========
+
+    /**
+     * @brief Totals over every indexed plant
+     */
+    InventoryTotals getTotals() const;
+
+    /**
+     * @brief Totals for plants that are (or are not) ready for sale
+     */
+    InventoryTotals getReadinessTotals(bool ready) const;
+
+    /**
+     * @brief Totals for one species (all zero if none is held)
+     */
+    InventoryTotals getSpeciesTotals(const std::string& species) const;
+
+    /**
+     * @brief Totals for one species and readiness class
+     */
+    InventoryTotals getSpeciesTotals(const std::string& species, bool ready) const;
+
+    /**
+     * @brief Every species seen so far (some may currently have no plants)
+     */
+    const std::vector<std::string>& getSpeciesNames() const;
+
+    /**
+     * @brief Index of a species in getSpeciesNames() (as in Keys::species), or NO_SPECIES
+     */
+    uint32_t speciesIndexOf(const std::string& species) const;
+
+    static constexpr uint32_t NO_SPECIES = static_cast<uint32_t>(-1);
+
+    void reserve(size_t capacity);
+};
+
+#endif // INVENTORYINDEX_H
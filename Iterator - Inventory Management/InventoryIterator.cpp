@@ -3,16 +3,35 @@
 #include "../Plant - Abstract Base/Plant.h"
 
 InventoryIterator::InventoryIterator(GreenhouseInventory* inv) 
-    : inventory(inv), currentIndex(0) {
-    // Make a copy of the plants for safe iteration
+    : inventory(inv), currentIndex(0), version(0), prevLive(nullptr), nextLive(nullptr) {
+    // No copy: read the inventory's storage until it changes
     if (inventory) {
-        size_t count = inventory->getCount();
-        for (size_t i = 0; i < count; i++) {
-            plants.push_back(inventory->getPlantAt(i));
-        }
+        version = inventory->getVersion();
+        inventory->registerIterator(this);
     }
 }
 
+InventoryIterator::~InventoryIterator() {
+    if (inventory) {
+        inventory->unregisterIterator(this);
+    }
+}
+
+void InventoryIterator::detach(const std::shared_ptr<const std::vector<Plant*>>& contents) {
+    snapshot = contents;
+    inventory = nullptr;
+    prevLive = nullptr;
+    nextLive = nullptr;
+}
+
+const std::vector<Plant*>& InventoryIterator::view() const {
+    if (inventory && inventory->getVersion() == version) {
+        return inventory->plants;
+    }
+    static const std::vector<Plant*> empty;
+    return snapshot ? *snapshot : empty;
+}
+
 void InventoryIterator::first() {
     currentIndex = 0;
 }
@@ -24,12 +43,17 @@ void InventoryIterator::next() {
 }
 
 bool InventoryIterator::isDone() const {
-    return currentIndex >= plants.size();
+    return currentIndex >= view().size();
 }
 
 Plant* InventoryIterator::currentItem() const {
-    if (isDone()) {
+    const std::vector<Plant*>& plants = view();
+    if (currentIndex >= plants.size()) {
         return nullptr;
     }
     return plants[currentIndex];
 }
+
+bool InventoryIterator::isDetached() const {
+    return inventory == nullptr;
+}
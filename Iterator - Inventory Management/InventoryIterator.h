@@ -1,25 +1,57 @@
 #ifndef INVENTORYITERATOR_H
 #define INVENTORYITERATOR_H
 #include "PlantIterator.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 class GreenhouseInventory;
 class Plant;
 
+/**
+ * @brief Iterator that walks a GreenhouseInventory's storage in place
+ *
+ * Creating one costs O(1): nothing is copied up front. The iterator records
+ * the inventory's modification version and registers itself with the
+ * inventory; if the inventory is about to change while the iterator is live,
+ * the inventory hands it a snapshot of the contents as they were, so the
+ * iteration is unaffected by the change (the same view the iterator had when
+ * it was created). The snapshot is taken once per change and shared by all
+ * live iterators.
+ */
 class InventoryIterator : public PlantIterator {
 private:
-    GreenhouseInventory* inventory;  // Relationship
+    GreenhouseInventory* inventory;  // Relationship (nullptr once detached)
     size_t currentIndex;
-    std::vector<Plant*> plants;
+    uint64_t version;                // Inventory version the live view belongs to
+    std::shared_ptr<const std::vector<Plant*>> snapshot;   // Set once detached
+
+    // Intrusive list of the inventory's live iterators
+    InventoryIterator* prevLive;
+    InventoryIterator* nextLive;
+
+    friend class GreenhouseInventory;
+
+    void detach(const std::shared_ptr<const std::vector<Plant*>>& contents);
+    const std::vector<Plant*>& view() const;
 
 public:
     InventoryIterator(GreenhouseInventory* inv);
-    virtual ~InventoryIterator() = default;
+    virtual ~InventoryIterator();
+
+    InventoryIterator(const InventoryIterator&) = delete;
+    InventoryIterator& operator=(const InventoryIterator&) = delete;
     
     void first() override;
     void next() override;
     bool isDone() const override;
     Plant* currentItem() const override;
+
+    /**
+     * @brief Whether the inventory changed since creation (iteration continues on a snapshot)
+     */
+    bool isDetached() const;
 };
 
 #endif // INVENTORYITERATOR_H
@@ -1,7 +1,9 @@
 #include "InventoryManager.h"
 #include "PlantCollection.h"
 #include "PlantIterator.h"
+#include "GreenhouseInventory.h"
 #include "../Plant - Abstract Base/Plant.h"
+#include <iomanip>
 #include <iostream>
 
 InventoryManager::InventoryManager() : collection(nullptr) {
@@ -48,7 +50,18 @@ void InventoryManager::displayInventory() {
             std::cout << "Plant " << ++count << std::endl;
         }
     }
-    std::cout << "Total plants: " << count << std::endl;
+
+    // A GreenhouseInventory keeps running totals, so the summary needs no second pass
+    GreenhouseInventory* inventory = dynamic_cast<GreenhouseInventory*>(collection);
+    if (inventory) {
+        InventoryTotals totals = inventory->getTotals();
+        std::cout << "Total plants: " << totals.count
+                  << " (" << inventory->getReadinessTotals(true).count << " ready for sale)" << std::endl;
+        std::cout << "Stock value: R" << std::fixed << std::setprecision(2) << totals.stockValue
+                  << ", average health: " << std::setprecision(1) << totals.averageHealth() << "%" << std::endl;
+    } else {
+        std::cout << "Total plants: " << count << std::endl;
+    }
     
     delete iterator;
 }
@@ -0,0 +1,182 @@
+#include "InventoryRanking.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include <cmath>
+#include <limits>
+
+InventoryRanking::InventoryRanking() {
+    for (bool& flag : built) {
+        flag = false;
+    }
+}
+
+double InventoryRanking::keyOf(PlantRank rank, const InventoryIndex::Keys& keys) {
+    switch (rank) {
+        case PlantRank::Price: return keys.price;
+        case PlantRank::Health: return static_cast<double>(keys.health);
+        case PlantRank::Maturity: return static_cast<double>(keys.maturityDay);
+    }
+    return 0.0;
+}
+
+bool InventoryRanking::isRanked(PlantRank rank, const InventoryIndex::Keys& keys) {
+    return rank != PlantRank::Maturity || !keys.ready;
+}
+
+// ========== MAINTENANCE ==========
+
+void InventoryRanking::add(PlantRank rank, const Plant* plant, const InventoryIndex::Keys& keys) {
+    if (!isRanked(rank, keys)) {
+        return;
+    }
+    Orders& order = orders[static_cast<size_t>(rank)];
+    const Entry entry{keyOf(rank, keys), keys.plantId, plant};
+    if (keys.species >= order.bySpecies.size()) {
+        order.bySpecies.resize(keys.species + 1);
+        order.readyBySpecies.resize(keys.species + 1);
+    }
+    order.all.insert(entry);
+    order.bySpecies[keys.species].insert(entry);
+    if (keys.ready) {
+        order.ready.insert(entry);
+        order.readyBySpecies[keys.species].insert(entry);
+    }
+}
+
+void InventoryRanking::remove(PlantRank rank, const Plant* plant, const InventoryIndex::Keys& keys) {
+    if (!isRanked(rank, keys)) {
+        return;
+    }
+    Orders& order = orders[static_cast<size_t>(rank)];
+    const Entry entry{keyOf(rank, keys), keys.plantId, plant};
+    order.all.erase(entry);
+    order.bySpecies[keys.species].erase(entry);
+    if (keys.ready) {
+        order.ready.erase(entry);
+        order.readyBySpecies[keys.species].erase(entry);
+    }
+}
+
+void InventoryRanking::insert(const Plant* plant, const InventoryIndex::Keys& keys) {
+    for (size_t i = 0; i < RANK_COUNT; i++) {
+        if (built[i]) {
+            add(static_cast<PlantRank>(i), plant, keys);
+        }
+    }
+}
+
+void InventoryRanking::erase(const Plant* plant, const InventoryIndex::Keys& keys) {
+    for (size_t i = 0; i < RANK_COUNT; i++) {
+        if (built[i]) {
+            remove(static_cast<PlantRank>(i), plant, keys);
+        }
+    }
+}
+
+void InventoryRanking::update(const Plant* plant, const InventoryIndex::Keys& before,
+                              const InventoryIndex::Keys& after) {
+    for (size_t i = 0; i < RANK_COUNT; i++) {
+        if (!built[i]) {
+            continue;
+        }
+        PlantRank rank = static_cast<PlantRank>(i);
+        if (keyOf(rank, before) != keyOf(rank, after) || before.plantId != after.plantId ||
+            before.species != after.species || before.ready != after.ready) {
+            remove(rank, plant, before);
+            add(rank, plant, after);
+        }
+    }
+}
+
+void InventoryRanking::ensureBuilt(PlantRank rank, const std::vector<Plant*>& plants,
+                                   const InventoryIndex& index) {
+    size_t i = static_cast<size_t>(rank);
+    if (built[i]) {
+        return;
+    }
+    for (size_t position = 0; position < plants.size(); position++) {
+        add(rank, plants[position], index.keysAt(position));
+    }
+    built[i] = true;
+}
+
+// ========== RANKED WALKS ==========
+
+const std::set<InventoryRanking::Entry>* InventoryRanking::orderFor(PlantRank rank, const InventoryQuery& filter,
+                                                                    const InventoryIndex& index) const {
+    if (rank == PlantRank::Maturity && filter.readyOnly) {
+        return nullptr;   // Ready plants are not ranked by maturity
+    }
+    const Orders& order = orders[static_cast<size_t>(rank)];
+    if (filter.species.empty()) {
+        return filter.readyOnly ? &order.ready : &order.all;
+    }
+    uint32_t species = index.speciesIndexOf(filter.species);
+    if (species >= order.bySpecies.size()) {
+        return nullptr;
+    }
+    return filter.readyOnly ? &order.readyBySpecies[species] : &order.bySpecies[species];
+}
+
+std::vector<Plant*> InventoryRanking::collect(PlantRank rank, bool descending,
+                                              const InventoryQuery& filter, const InventoryIndex& index,
+                                              size_t count, const Entry* after, Entry& last) const {
+    std::vector<Plant*> result;
+    const std::set<Entry>* chosen = orderFor(rank, filter, index);
+    if (count == 0 || !chosen) {
+        return result;
+    }
+    const std::set<Entry>& order = *chosen;
+    result.reserve(count);
+
+    // The filter's own range on the ranked key bounds the walk
+    double low = -std::numeric_limits<double>::infinity();
+    double high = std::numeric_limits<double>::infinity();
+    if (rank == PlantRank::Price) {
+        if (filter.minPrice > 0.0) {
+            low = filter.minPrice;
+        }
+        high = filter.maxPrice;
+    } else if (rank == PlantRank::Health) {
+        low = static_cast<double>(filter.minHealth);
+        high = static_cast<double>(filter.maxHealth);
+    }
+    if (low > high) {
+        return result;
+    }
+
+    auto accept = [&](const Entry& entry) {
+        Plant* plant = const_cast<Plant*>(entry.plant);
+        if (!InventoryIndex::matches(plant, filter)) {
+            return false;
+        }
+        result.push_back(plant);
+        last = entry;
+        return result.size() == count;
+    };
+
+    if (!descending) {
+        auto it = after ? order.upper_bound(*after) : order.begin();
+        if (it != order.end() && it->key < low) {
+            it = order.lower_bound(Entry{low, std::numeric_limits<int>::min(), nullptr});
+        }
+        for (; it != order.end() && it->key <= high; ++it) {
+            if (accept(*it)) {
+                break;
+            }
+        }
+    } else {
+        auto it = after ? order.lower_bound(*after) : order.end();
+        auto aboveHigh = order.lower_bound(Entry{std::nextafter(high, std::numeric_limits<double>::infinity()),
+                                                 std::numeric_limits<int>::min(), nullptr});
+        if (it == order.end() || (aboveHigh != order.end() && *aboveHigh < *it)) {
+            it = aboveHigh;
+        }
+        while (it != order.begin()) {
+            --it;
+            if (it->key < low || accept(*it)) {
+                break;
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,107 @@
+#ifndef INVENTORYRANKING_H
+#define INVENTORYRANKING_H
+#include "InventoryIndex.h"
+#include <cstddef>
+#include <set>
+#include <vector>
+
+class Plant;
+
+/**
+ * @brief Orders a GreenhouseInventory can be ranked by
+ */
+enum class PlantRank {
+    Price,          // Base price
+    Health,         // Health level
+    Maturity        // Days left until maturity (plants already ready are not ranked)
+};
+
+/**
+ * @brief Ordered indexes over the plants of an inventory, one set per PlantRank
+ *
+ * Each rank keeps balanced trees of (key, plant): one over every ranked
+ * plant, one over the plants ready for sale, and the same two per species.
+ * They are built the first time the rank is used and kept current from then
+ * on. A top-K request walks the tree matching the filter's species and
+ * readiness, starting at the filter's bound on the ranked key itself (price
+ * or health range), so it touches K matching entries instead of sorting or
+ * skipping over the inventory. Only the remaining filters (attention and the
+ * range of a key not being ranked by) are checked entry by entry.
+ *
+ * Plants that are ready for sale are kept out of the Maturity order, and
+ * move in or out of it when their readiness changes.
+ *
+ * Ties are broken by plant ID (then address, should two plants share an
+ * ID), so the order is total and the same on every run, and pagination is
+ * stable.
+ */
+class InventoryRanking {
+public:
+    static constexpr size_t RANK_COUNT = 3;
+
+    struct Entry {
+        double key;
+        int plantId;
+        const Plant* plant;
+
+        bool operator<(const Entry& other) const {
+            if (key != other.key) {
+                return key < other.key;
+            }
+            if (plantId != other.plantId) {
+                return plantId < other.plantId;
+            }
+            return plant < other.plant;
+        }
+    };
+
+private:
+    /**
+     * @brief The trees of one rank, narrowed by the filters they answer
+     */
+    struct Orders {
+        std::set<Entry> all;                           // Every ranked plant
+        std::set<Entry> ready;                         // Ready for sale
+        std::vector<std::set<Entry>> bySpecies;        // By InventoryIndex species index
+        std::vector<std::set<Entry>> readyBySpecies;
+    };
+
+    Orders orders[RANK_COUNT];
+    bool built[RANK_COUNT];
+
+    static double keyOf(PlantRank rank, const InventoryIndex::Keys& keys);
+    static bool isRanked(PlantRank rank, const InventoryIndex::Keys& keys);
+    void add(PlantRank rank, const Plant* plant, const InventoryIndex::Keys& keys);
+    void remove(PlantRank rank, const Plant* plant, const InventoryIndex::Keys& keys);
+
+    /**
+     * @brief Tree holding exactly the plants of a filter's species and readiness, or nullptr if none can match
+     */
+    const std::set<Entry>* orderFor(PlantRank rank, const InventoryQuery& filter,
+                                    const InventoryIndex& index) const;
+
+public:
+    InventoryRanking();
+
+    void insert(const Plant* plant, const InventoryIndex::Keys& keys);
+    void erase(const Plant* plant, const InventoryIndex::Keys& keys);
+    void update(const Plant* plant, const InventoryIndex::Keys& before, const InventoryIndex::Keys& after);
+
+    /**
+     * @brief Build an order from the current contents if it is not maintained yet
+     */
+    void ensureBuilt(PlantRank rank, const std::vector<Plant*>& plants, const InventoryIndex& index);
+
+    /**
+     * @brief Up to 'count' plants matching a filter, in rank order, after a given entry
+     * @param descending Highest key first
+     * @param index Index the inventory files its plants in (resolves the filter's species)
+     * @param after Entry to resume after (nullptr to start from the top)
+     * @param last Receives the entry of the last plant returned
+     */
+    std::vector<Plant*> collect(PlantRank rank, bool descending, const InventoryQuery& filter,
+                                const InventoryIndex& index, size_t count, const Entry* after,
+                                Entry& last) const;
+};
+
+#endif // INVENTORYRANKING_H
@@ -0,0 +1,44 @@
+#ifndef INVENTORYTOTALS_H
+#define INVENTORYTOTALS_H
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Running totals for a group of plants (count, stock value, health)
+ */
+struct InventoryTotals {
+    size_t count = 0;
+    double stockValue = 0.0;        // Sum of base prices
+    int64_t healthSum = 0;
+
+    void add(double price, int health) {
+        count++;
+        stockValue += price;
+        healthSum += health;
+    }
+
+    void remove(double price, int health) {
+        count--;
+        stockValue -= price;
+        healthSum -= health;
+        if (count == 0) {
+            stockValue = 0.0;       // Drop accumulated rounding error
+        }
+    }
+
+    void merge(const InventoryTotals& other) {
+        count += other.count;
+        stockValue += other.stockValue;
+        healthSum += other.healthSum;
+    }
+
+    double averageHealth() const {
+        return count == 0 ? 0.0 : static_cast<double>(healthSum) / static_cast<double>(count);
+    }
+
+    double averagePrice() const {
+        return count == 0 ? 0.0 : stockValue / static_cast<double>(count);
+    }
+};
+
+#endif // INVENTORYTOTALS_H
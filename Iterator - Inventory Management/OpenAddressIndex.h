@@ -0,0 +1,158 @@
+#ifndef OPENADDRESSINDEX_H
+#define OPENADDRESSINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Open-addressing hash map from an integer or pointer key to a position
+ *
+ * Linear probing over a power-of-two table kept at most half full; erase uses
+ * backward shifting, so there are no tombstones and lookups stay short no
+ * matter how many insertions and removals have happened.
+ */
+template <typename Key>
+class OpenAddressIndex {
+    static_assert(std::is_integral<Key>::value || std::is_pointer<Key>::value,
+                  "OpenAddressIndex keys are integers or pointers");
+
+private:
+    struct Entry {
+        Key key;
+        size_t value;
+        bool used;
+    };
+
+    std::vector<Entry> table;
+    size_t count;
+
+    static uint64_t hashOf(Key key) {
+        uint64_t x;
+        if constexpr (std::is_pointer<Key>::value) {
+            x = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key));
+        } else {
+            x = static_cast<uint64_t>(key);
+        }
+        // splitmix64 finaliser - spreads sequential IDs and aligned addresses
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    size_t home(Key key) const {
+        return static_cast<size_t>(hashOf(key)) & (table.size() - 1);
+    }
+
+    void rehash(size_t newSize) {
+        std::vector<Entry> old;
+        old.swap(table);
+        table.assign(newSize, Entry{Key(), 0, false});
+        for (const Entry& entry : old) {
+            if (entry.used) {
+                size_t i = home(entry.key);
+                while (table[i].used) {
+                    i = (i + 1) & (table.size() - 1);
+                }
+                table[i] = entry;
+            }
+        }
+    }
+
+public:
+    static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+    OpenAddressIndex() : count(0) {}
+
+    size_t size() const { return count; }
+
+    /**
+     * @brief Value stored for key, or NPOS
+     */
+    size_t find(Key key) const {
+        if (count == 0) {
+            return NPOS;
+        }
+        for (size_t i = home(key);; i = (i + 1) & (table.size() - 1)) {
+            if (!table[i].used) {
+                return NPOS;
+            }
+            if (table[i].key == key) {
+                return table[i].value;
+            }
+        }
+    }
+
+    /**
+     * @brief Insert or overwrite the value for key
+     */
+    void assign(Key key, size_t value) {
+        if (2 * (count + 1) > table.size()) {
+            rehash(table.empty() ? 16 : table.size() * 2);
+        }
+        size_t i = home(key);
+        while (table[i].used) {
+            if (table[i].key == key) {
+                table[i].value = value;
+                return;
+            }
+            i = (i + 1) & (table.size() - 1);
+        }
+        table[i] = Entry{key, value, true};
+        count++;
+    }
+
+    /**
+     * @brief Remove key (no-op if absent)
+     */
+    void erase(Key key) {
+        if (count == 0) {
+            return;
+        }
+        const size_t mask = table.size() - 1;
+        size_t i = home(key);
+        while (table[i].used && table[i].key != key) {
+            i = (i + 1) & mask;
+        }
+        if (!table[i].used) {
+            return;
+        }
+
+        // Backward shift: pull later entries of the probe run into the gap
+        size_t gap = i;
+        for (size_t j = (gap + 1) & mask; table[j].used; j = (j + 1) & mask) {
+            size_t want = home(table[j].key);
+            bool movable = gap <= j ? (want <= gap || want > j) : (want <= gap && want > j);
+            if (movable) {
+                table[gap] = table[j];
+                gap = j;
+            }
+        }
+        table[gap].used = false;
+        count--;
+    }
+
+    /**
+     * @brief Size the table for n keys without further rehashing
+     */
+    void reserve(size_t n) {
+        size_t wanted = 16;
+        while (wanted < 2 * n) {
+            wanted *= 2;
+        }
+        if (wanted > table.size()) {
+            rehash(wanted);
+        }
+    }
+
+    void clear() {
+        table.clear();
+        count = 0;
+    }
+};
+
+#endif // OPENADDRESSINDEX_H
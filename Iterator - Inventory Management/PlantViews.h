@@ -0,0 +1,71 @@
+#ifndef PLANTVIEWS_H
+#define PLANTVIEWS_H
+#include "../Plant - Abstract Base/Plant.h"
+#include <ranges>
+#include <string>
+#include <utility>
+
+/**
+ * @brief Lazy, composable C++20 range adaptors over collections of Plant*
+ *
+ * Each function returns a range adaptor closure that can be piped onto any
+ * range of Plant* - a GreenhouseInventory, a ConcurrentInventory snapshot or
+ * a std::vector<Plant*> - and combined with the standard views:
+ *
+ *   for (Plant* plant : inventory | PlantViews::ofSpecies("Rose")
+ *                                 | PlantViews::readyForSale()
+ *                                 | std::views::take(10)) { ... }
+ *
+ *   double stock = 0.0;
+ *   for (double price : inventory | PlantViews::prices()) stock += price;
+ *
+ * Nothing is copied: filters are evaluated as the view is walked. The
+ * collections themselves are random-access, so they can also be handed to
+ * the parallel algorithms (std::execution::par_unseq) directly; ordering
+ * ("sort") is left to std::ranges::partial_sort_copy into caller storage.
+ */
+class PlantViews {
+public:
+    static auto ofSpecies(std::string species) {
+        return std::views::filter([species = std::move(species)](const Plant* plant) {
+            return plant->getSpecies() == species;
+        });
+    }
+
+    static auto readyForSale() {
+        return std::views::filter([](const Plant* plant) { return plant->isReadyForSale(); });
+    }
+
+    static auto needingAttention() {
+        return std::views::filter([](const Plant* plant) { return plant->needsAttention(); });
+    }
+
+    /**
+     * @brief Plants whose health is within [minHealth, maxHealth]
+     */
+    static auto healthBetween(int minHealth, int maxHealth = 100) {
+        return std::views::filter([minHealth, maxHealth](const Plant* plant) {
+            int health = plant->getHealthLevel();
+            return health >= minHealth && health <= maxHealth;
+        });
+    }
+
+    /**
+     * @brief Plants whose base price is within [minPrice, maxPrice]
+     */
+    static auto priceBetween(double minPrice, double maxPrice) {
+        return std::views::filter([minPrice, maxPrice](const Plant* plant) {
+            double price = plant->getBasePrice();
+            return price >= minPrice && price <= maxPrice;
+        });
+    }
+
+    /**
+     * @brief Each plant's base price
+     */
+    static auto prices() {
+        return std::views::transform([](const Plant* plant) { return plant->getBasePrice(); });
+    }
+};
+
+#endif // PLANTVIEWS_H
@@ -0,0 +1,126 @@
+#ifndef POSITIONBITMAP_H
+#define POSITIONBITMAP_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Growable bitset over inventory positions, 64 positions per word
+ *
+ * Predicates are combined a word at a time (andWith/orWith), so intersecting
+ * two indexes over N plants costs N/64 operations rather than N plant visits.
+ */
+class PositionBitmap {
+private:
+    std::vector<uint64_t> words;
+
+public:
+    static constexpr size_t BITS_PER_WORD = 64;
+
+    void set(size_t position) {
+        size_t word = position / BITS_PER_WORD;
+        if (word >= words.size()) {
+            words.resize(word + 1, 0);
+        }
+        words[word] |= uint64_t(1) << (position % BITS_PER_WORD);
+    }
+
+    void reset(size_t position) {
+        size_t word = position / BITS_PER_WORD;
+        if (word < words.size()) {
+            words[word] &= ~(uint64_t(1) << (position % BITS_PER_WORD));
+        }
+    }
+
+    void assign(size_t position, bool value) {
+        if (value) {
+            set(position);
+        } else {
+            reset(position);
+        }
+    }
+
+    bool test(size_t position) const {
+        size_t word = position / BITS_PER_WORD;
+        return word < words.size() && (words[word] >> (position % BITS_PER_WORD)) & 1;
+    }
+
+    /**
+     * @brief Set positions [0, count) and clear everything else
+     */
+    void fill(size_t count) {
+        words.assign((count + BITS_PER_WORD - 1) / BITS_PER_WORD, ~uint64_t(0));
+        if (count % BITS_PER_WORD != 0) {
+            words.back() = (uint64_t(1) << (count % BITS_PER_WORD)) - 1;
+        }
+    }
+
+    /**
+     * @brief Clear every position and size the bitmap for [0, positions)
+     */
+    void assignZeros(size_t positions) {
+        words.assign((positions + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+    }
+
+    uint64_t* data() { return words.data(); }
+    const uint64_t* data() const { return words.data(); }
+    size_t wordCount() const { return words.size(); }
+
+    void andWith(const PositionBitmap& other) {
+        size_t shared = words.size() < other.words.size() ? words.size() : other.words.size();
+        for (size_t i = 0; i < shared; i++) {
+            words[i] &= other.words[i];
+        }
+        words.resize(shared);
+    }
+
+    void orWith(const PositionBitmap& other) {
+        if (other.words.size() > words.size()) {
+            words.resize(other.words.size(), 0);
+        }
+        for (size_t i = 0; i < other.words.size(); i++) {
+            words[i] |= other.words[i];
+        }
+    }
+
+    void andNotWith(const PositionBitmap& other) {
+        size_t shared = words.size() < other.words.size() ? words.size() : other.words.size();
+        for (size_t i = 0; i < shared; i++) {
+            words[i] &= ~other.words[i];
+        }
+    }
+
+    size_t count() const {
+        size_t total = 0;
+        for (uint64_t word : words) {
+            total += static_cast<size_t>(std::popcount(word));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Call visit(position) for every set position, in increasing order
+     */
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        for (size_t i = 0; i < words.size(); i++) {
+            uint64_t word = words[i];
+            while (word) {
+                visit(i * BITS_PER_WORD + static_cast<size_t>(std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
+    void reserve(size_t positions) {
+        words.reserve((positions + BITS_PER_WORD - 1) / BITS_PER_WORD);
+    }
+
+    void clear() {
+        words.clear();
+    }
+};
+
+#endif // POSITIONBITMAP_H
@@ -0,0 +1,29 @@
+#include "RankingCursor.h"
+#include "GreenhouseInventory.h"
+
+RankingCursor::RankingCursor(const GreenhouseInventory* inventory, PlantRank rank, bool highestFirst,
+                             const InventoryQuery& filter)
+    : inventory(inventory), rank(rank), highestFirst(highestFirst), filter(filter),
+      last{0.0, 0, nullptr}, started(false), done(false) {
+}
+
+std::vector<Plant*> RankingCursor::next(size_t count) {
+    if (done || count == 0) {
+        return std::vector<Plant*>();
+    }
+    std::vector<Plant*> page =
+        inventory->rankedPage(rank, highestFirst, filter, count, started ? &last : nullptr, last);
+    started = started || !page.empty();
+    done = page.size() < count;
+    return page;
+}
+
+bool RankingCursor::isDone() const {
+    return done;
+}
+
+void RankingCursor::reset() {
+    last = InventoryRanking::Entry{0.0, 0, nullptr};
+    started = false;
+    done = false;
+}
@@ -0,0 +1,48 @@
+#ifndef RANKINGCURSOR_H
+#define RANKINGCURSOR_H
+#include "InventoryRanking.h"
+#include <cstddef>
+#include <vector>
+
+class GreenhouseInventory;
+class Plant;
+
+/**
+ * @brief Page-by-page walk over a ranked inventory
+ *
+ * The cursor remembers the rank key of the last plant it returned and resumes
+ * just past it, so each page costs O(log N + page size) and paging stays
+ * correct when plants are added or removed in between. A plant whose key
+ * changes between pages may be returned again or skipped, like a row updated
+ * during a paginated database read.
+ *
+ * Obtained from GreenhouseInventory::rankCursor(); must not outlive the inventory.
+ */
+class RankingCursor {
+private:
+    const GreenhouseInventory* inventory;
+    PlantRank rank;
+    bool highestFirst;
+    InventoryQuery filter;
+    InventoryRanking::Entry last;
+    bool started;
+    bool done;
+
+public:
+    RankingCursor(const GreenhouseInventory* inventory, PlantRank rank, bool highestFirst,
+                  const InventoryQuery& filter);
+
+    /**
+     * @brief Next page of up to 'count' plants (empty once the ranking is exhausted)
+     */
+    std::vector<Plant*> next(size_t count);
+
+    bool isDone() const;
+
+    /**
+     * @brief Start again from the top of the ranking
+     */
+    void reset();
+};
+
+#endif // RANKINGCURSOR_H
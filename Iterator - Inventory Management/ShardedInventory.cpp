@@ -0,0 +1,206 @@
+#include "ShardedInventory.h"
+#include "ShardedInventoryIterator.h"
+#include "../Composite - The Store layout/GreenhouseComponent.h"
+#include "../Composite - The Store layout/GreenhouseSection.h"
+#include "../Composite - The Store layout/FlatGreenhouseTree.h"
+#include "../Composite - The Store layout/PlantLeaf.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include <cstdint>
+#include <thread>
+
+namespace {
+    uint64_t mix(uint64_t x) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        return x;
+    }
+}
+
+ShardedInventory::ShardedInventory(size_t count)
+    : shardCount(count == 0 ? 1 : count), layoutRoot(nullptr), unplacedShard(0) {
+    shards.reset(new Shard[shardCount]);
+}
+
+ShardedInventory::ShardedInventory(const GreenhouseComponent* root)
+    : shardCount(0), layoutRoot(root), unplacedShard(0) {
+    FlatGreenhouseTree scratch;
+    uint32_t top = 0;
+    const FlatGreenhouseTree& tree = root ? root->layoutRows(scratch, top) : scratch;
+    std::vector<uint32_t> sections;
+    if (!tree.isEmpty()) {
+        for (uint32_t child : tree.childrenOf(top)) {
+            if (tree.getComponent(child)->isComposite()) {
+                sections.push_back(child);
+            }
+        }
+    }
+    unplacedShard = sections.size();
+    shardCount = sections.size() + 1;
+    shards.reset(new Shard[shardCount]);
+    shards[unplacedShard].name = "unplaced";
+
+    for (size_t shard = 0; shard < sections.size(); shard++) {
+        const GreenhouseComponent* section = tree.getComponent(sections[shard]);
+        shards[shard].name = tree.getKind(sections[shard]) == GreenhouseNodeKind::Section
+                                 ? static_cast<const GreenhouseSection*>(section)->getSectionType()
+                                 : section->getName();
+        sectionShard.assign(section, shard);
+    }
+    tree.forEachPlant(top, [this](Plant* plant) { addPlant(plant); });
+}
+
+ShardedInventory::~ShardedInventory() {
+    // Note: We don't delete plants here - ownership remains with creator
+}
+
+size_t ShardedInventory::shardFor(const Plant* plant) const {
+    if (!layoutRoot) {
+        return static_cast<size_t>(mix(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(plant))) %
+                                   shardCount);
+    }
+
+    // Climb from each of the plant's leaves to the child of the root it sits under
+    for (const PlantLeaf* leaf = plant->getLeaf(); leaf; leaf = leaf->getNextLeafOfPlant()) {
+        const GreenhouseComponent* node = leaf;
+        while (node && node->getParent() != layoutRoot) {
+            node = node->getParent();
+        }
+        if (node) {
+            size_t shard = sectionShard.find(node);
+            return shard != OpenAddressIndex<const GreenhouseComponent*>::NPOS ? shard : unplacedShard;
+        }
+    }
+    return unplacedShard;   // Not in this layout
+}
+
+size_t ShardedInventory::findShard(const Plant* plant) const {
+    // Usually where it would be routed now; the plant may have moved section since it was added
+    const size_t routed = shardFor(plant);
+    for (size_t i = 0; i < shardCount; i++) {
+        const size_t index = (routed + i) % shardCount;
+        const Shard& shard = shards[index];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.positionOf.find(plant) != OpenAddressIndex<const Plant*>::NPOS) {
+            return index;
+        }
+        if (!layoutRoot) {
+            break;   // Hash routing never changes
+        }
+    }
+    return OpenAddressIndex<const Plant*>::NPOS;
+}
+
+PlantIterator* ShardedInventory::createIterator() {
+    return new ShardedInventoryIterator(this, 0, shardCount);
+}
+
+PlantIterator* ShardedInventory::createShardIterator(size_t shard) {
+    if (shard >= shardCount) {
+        return new ShardedInventoryIterator(this, 0, 0);
+    }
+    return new ShardedInventoryIterator(this, shard, shard + 1);
+}
+
+// ========== SHARD-LOCAL UPDATES ==========
+
+void ShardedInventory::addPlant(Plant* plant) {
+    if (!plant || (layoutRoot && findShard(plant) != OpenAddressIndex<const Plant*>::NPOS)) {
+        return;   // Already held, possibly in the shard of a section it has since left
+    }
+    Shard& shard = shards[shardFor(plant)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.positionOf.find(plant) != OpenAddressIndex<const Plant*>::NPOS) {
+        return;
+    }
+    shard.positionOf.assign(plant, shard.plants.size());
+    shard.plants.push_back(plant);
+}
+
+void ShardedInventory::removePlant(Plant* plant) {
+    if (!plant) {
+        return;
+    }
+    const size_t held = findShard(plant);
+    if (held == OpenAddressIndex<const Plant*>::NPOS) {
+        return;
+    }
+    Shard& shard = shards[held];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size_t index = shard.positionOf.find(plant);
+    if (index == OpenAddressIndex<const Plant*>::NPOS) {
+        return;
+    }
+    shard.positionOf.erase(plant);
+
+    // Swap-remove: the last plant takes over the freed position
+    Plant* last = shard.plants.back();
+    shard.plants.pop_back();
+    if (last != plant) {
+        shard.plants[index] = last;
+        shard.positionOf.assign(last, index);
+    }
+}
+
+// ========== QUERIES ==========
+
+bool ShardedInventory::isEmpty() const {
+    return getCount() == 0;
+}
+
+size_t ShardedInventory::getCount() const {
+    size_t total = 0;
+    for (size_t i = 0; i < shardCount; i++) {
+        total += getShardSize(i);
+    }
+    return total;
+}
+
+size_t ShardedInventory::getShardCount() const {
+    return shardCount;
+}
+
+size_t ShardedInventory::getShardSize(size_t shard) const {
+    if (shard >= shardCount) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(shards[shard].mutex);
+    return shards[shard].plants.size();
+}
+
+std::string ShardedInventory::getShardName(size_t shard) const {
+    return shard < shardCount ? shards[shard].name : "";
+}
+
+size_t ShardedInventory::shardOf(const Plant* plant) const {
+    const size_t held = findShard(plant);
+    return held != OpenAddressIndex<const Plant*>::NPOS ? held : shardFor(plant);
+}
+
+bool ShardedInventory::contains(const Plant* plant) const {
+    return findShard(plant) != OpenAddressIndex<const Plant*>::NPOS;
+}
+
+// ========== PARALLEL ITERATION ==========
+
+void ShardedInventory::forEachShardParallel(const ShardVisitor& visit) const {
+    auto visitShard = [this, &visit](size_t index) {
+        const Shard& shard = shards[index];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        visit(index, shard.plants);
+    };
+    if (shardCount == 1) {
+        visitShard(0);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(shardCount - 1);
+    for (size_t i = 1; i < shardCount; i++) {
+        workers.emplace_back(visitShard, i);
+    }
+    visitShard(0);   // The calling thread takes the first shard
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
@@ -0,0 +1,116 @@
+#ifndef SHARDEDINVENTORY_H
+#define SHARDEDINVENTORY_H
+#include "PlantCollection.h"
+#include "OpenAddressIndex.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Plant;
+class PlantIterator;
+class GreenhouseComponent;
+
+/**
+ * @brief Plant collection split into independently locked shards
+ *
+ * Each shard is a dense vector with its own position index and mutex, on its
+ * own cache line, so threads adding, removing and scanning plants in
+ * different shards do not contend. Plants are routed to a shard either by
+ * the greenhouse section they sit in (one shard per top-level section of the
+ * composite tree) or by a hash of the plant's address. Addresses are used
+ * rather than IDs because an ID can be renumbered while the plant is held.
+ *
+ * In section mode a plant's section is looked up when it is added, through
+ * its leaves in the layout (Plant::getLeaf()), so plants placed after the
+ * inventory was built still land in the right shard. Plants with no leaf
+ * under one of the sections go to a final "unplaced" shard rather than into
+ * some unrelated section. The layout must not change while another thread
+ * is adding or removing plants.
+ *
+ * createIterator() walks every shard in turn, copying one shard at a time
+ * under its lock, so each shard is seen consistently. forEachShardParallel()
+ * runs one worker per shard.
+ */
+class ShardedInventory : public PlantCollection {
+public:
+    /**
+     * @brief Called once per shard with that shard's plants (the shard is locked meanwhile)
+     */
+    typedef std::function<void(size_t shard, const std::vector<Plant*>& plants)> ShardVisitor;
+
+private:
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        std::vector<Plant*> plants;
+        OpenAddressIndex<const Plant*> positionOf;   // Plant -> index in plants
+        std::string name;                            // Section name ("" for hash shards)
+    };
+
+    std::unique_ptr<Shard[]> shards;
+    size_t shardCount;
+    const GreenhouseComponent* layoutRoot;                 // nullptr in hash mode
+    OpenAddressIndex<const GreenhouseComponent*> sectionShard;   // Top-level section -> shard
+    size_t unplacedShard;                                  // Section mode: shard for plants in no section
+
+    size_t shardFor(const Plant* plant) const;
+    size_t findShard(const Plant* plant) const;            // Shard holding plant, or NPOS
+
+    friend class ShardedInventoryIterator;
+
+public:
+    /**
+     * @brief Hash-partitioned inventory
+     * @param count Number of shards (at least 1)
+     */
+    explicit ShardedInventory(size_t count);
+
+    /**
+     * @brief Section-partitioned inventory: one shard per top-level section of root, plus "unplaced"
+     *
+     * Every plant already in the layout is added. Later plants are routed by the
+     * section their leaf sits in when they are added; plants outside every
+     * section (not in the tree, directly under root, or under a section added
+     * to root afterwards) go to the last shard, named "unplaced".
+     */
+    explicit ShardedInventory(const GreenhouseComponent* root);
+
+    virtual ~ShardedInventory();
+
+    ShardedInventory(const ShardedInventory&) = delete;
+    ShardedInventory& operator=(const ShardedInventory&) = delete;
+
+    PlantIterator* createIterator() override;
+    void addPlant(Plant* plant) override;      // Ignored if the plant is already present
+    void removePlant(Plant* plant) override;
+    bool isEmpty() const override;
+    size_t getCount() const;
+
+    size_t getShardCount() const;
+    size_t getShardSize(size_t shard) const;
+    std::string getShardName(size_t shard) const;
+
+    /**
+     * @brief Shard a plant is stored in, or the one it would be added to
+     */
+    size_t shardOf(const Plant* plant) const;
+
+    bool contains(const Plant* plant) const;
+
+    /**
+     * @brief Iterator over a single shard
+     */
+    PlantIterator* createShardIterator(size_t shard);
+
+    /**
+     * @brief Visit every shard concurrently, one thread per shard
+     *
+     * Each shard is locked while its visitor runs, so the visitor must not add
+     * or remove plants of this inventory.
+     */
+    void forEachShardParallel(const ShardVisitor& visit) const;
+};
+
+#endif // SHARDEDINVENTORY_H
@@ -0,0 +1,45 @@
+#include "ShardedInventoryIterator.h"
+#include "ShardedInventory.h"
+#include <mutex>
+
+ShardedInventoryIterator::ShardedInventoryIterator(ShardedInventory* inv, size_t first, size_t end)
+    : inventory(inv), firstShard(first), endShard(end), shard(end), currentIndex(0) {
+    this->first();
+}
+
+void ShardedInventoryIterator::loadShard(size_t index) {
+    plants.clear();
+    currentIndex = 0;
+    for (shard = index; shard < endShard; shard++) {
+        const ShardedInventory::Shard& source = inventory->shards[shard];
+        std::lock_guard<std::mutex> lock(source.mutex);
+        if (!source.plants.empty()) {
+            plants = source.plants;
+            return;
+        }
+    }
+}
+
+void ShardedInventoryIterator::first() {
+    loadShard(firstShard);
+}
+
+void ShardedInventoryIterator::next() {
+    if (isDone()) {
+        return;
+    }
+    if (++currentIndex >= plants.size()) {
+        loadShard(shard + 1);
+    }
+}
+
+bool ShardedInventoryIterator::isDone() const {
+    return shard >= endShard;
+}
+
+Plant* ShardedInventoryIterator::currentItem() const {
+    if (isDone()) {
+        return nullptr;
+    }
+    return plants[currentIndex];
+}
@@ -0,0 +1,36 @@
+#ifndef SHARDEDINVENTORYITERATOR_H
+#define SHARDEDINVENTORYITERATOR_H
+#include "PlantIterator.h"
+#include <cstddef>
+#include <vector>
+
+class ShardedInventory;
+
+/**
+ * @brief Iterator over a range of ShardedInventory shards
+ *
+ * Shards are visited in order; each one is copied under its lock when the
+ * iterator reaches it, so other threads may keep using the inventory and
+ * only one shard's worth of plants is held at a time.
+ */
+class ShardedInventoryIterator : public PlantIterator {
+private:
+    ShardedInventory* inventory;
+    size_t firstShard;
+    size_t endShard;
+    size_t shard;                    // Shard currently loaded
+    size_t currentIndex;
+    std::vector<Plant*> plants;      // Copy of the current shard
+
+    void loadShard(size_t index);    // Loads the first non-empty shard from index on
+
+public:
+    ShardedInventoryIterator(ShardedInventory* inv, size_t first, size_t end);
+    
+    void first() override;
+    void next() override;
+    bool isDone() const override;
+    Plant* currentItem() const override;
+};
+
+#endif // SHARDEDINVENTORYITERATOR_H
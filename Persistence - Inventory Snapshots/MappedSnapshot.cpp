@@ -0,0 +1,681 @@
+#include "MappedSnapshot.h"
+#include "PlantSnapshot.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include "../Plant - Abstract Base/PlantStore.h"
+#include "../Flyweight - Species Traits/SpeciesTraits.h"
+#include "../Iterator - Inventory Management/GreenhouseInventory.h"
+#include "../Composite - The Store layout/GreenhouseComponent.h"
+#include "../Composite - The Store layout/Greenhouse.h"
+#include "../Composite - The Store layout/GreenhouseSection.h"
+#include "../Composite - The Store layout/Shelf.h"
+#include "../Composite - The Store layout/PlantLeaf.h"
+#include "../Composite - The Store layout/FlatGreenhouseTree.h"
+#include "../Factory - Plant Creation/PlantFactory.h"
+#include "../State - Plant lifecycle/PlantState.h"
+#include "../Core - Simulation Services/Logger.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const char MAGIC[8] = {'N', 'J', 'D', 'M', 'M', 'A', 'P', '1'};
+    const uint32_t BYTE_ORDER_MARK = 0x01020304;
+    const uint64_t ALIGNMENT = 64;
+    const uint32_t NONE = 0xFFFFFFFF;   // No parent / no plant
+    const uint64_t ANY_COUNT = ~0ULL;
+    const uint8_t OTHER = 255;          // Link set, but not restorable (see PlantSnapshot)
+
+    enum SectionId : uint32_t {
+        // PlantStore columns, in the store's declaration order
+        COLUMN_AGE = 1,
+        COLUMN_CURRENT_GROWTH_DAYS,
+        COLUMN_DAYS_TO_MATURITY,
+        COLUMN_HEALTH_LEVEL,
+        COLUMN_HEIGHT,
+        COLUMN_WATERING_FREQUENCY,
+        COLUMN_FERTILIZING_FREQUENCY,
+        COLUMN_TIMES_WATERED,
+        COLUMN_TIMES_FERTILIZED,
+        COLUMN_READY_FOR_SALE,
+        COLUMN_PLANT_ID,
+        COLUMN_BASE_PRICE,
+        COLUMN_SUNLIGHT_REQUIREMENT,
+        COLUMN_TIMES_PRUNED,
+        COLUMN_SHELF_NUMBER,
+        COLUMN_LAST_WATERED,
+        COLUMN_LAST_FERTILIZED,
+        COLUMN_LAST_PRUNED,
+        // Per-plant handle data
+        PLANT_TRAITS,        // u32 index into TRAITS_TABLE
+        PLANT_LOCATION,      // u32 string reference
+        PLANT_LINKS,         // LinkEntry
+        // Shared tables
+        TRAITS_TABLE,        // TraitsEntry
+        STRING_OFFSETS,      // u64[stringCount + 1] into STRING_BYTES
+        STRING_BYTES,
+        // Structure
+        INVENTORY_ORDER,     // u32 plant index
+        TREE_NODES,          // NodeEntry, pre-order
+        SECTION_LIMIT
+    };
+
+    struct Header {
+        char magic[8];
+        uint16_t version;
+        uint16_t sectionCount;
+        uint32_t byteOrder;
+        uint64_t plantCount;
+        uint64_t fileSize;
+        unsigned char reserved[32];
+    };
+
+    struct SectionEntry {
+        uint32_t id;
+        uint32_t elementSize;
+        uint64_t offset;
+        uint64_t count;
+    };
+
+    struct TraitsEntry {
+        uint32_t type;
+        uint32_t species;
+        uint32_t scientificName;
+        uint32_t soilType;
+        uint32_t season;
+    };
+
+    struct LinkEntry {
+        uint8_t state;
+        uint8_t strategy;
+        uint8_t routine;
+        uint8_t reserved;
+    };
+
+    enum NodeKind : uint8_t {
+        NODE_GREENHOUSE = 1,
+        NODE_SECTION,
+        NODE_SHELF,
+        NODE_LEAF
+    };
+
+    struct NodeEntry {
+        uint8_t kind;
+        uint8_t reserved[3];
+        uint32_t parent;
+        uint32_t name;
+        uint32_t sectionType;
+        int32_t number;
+        uint32_t plant;
+    };
+
+    static_assert(sizeof(Header) == 64, "header must stay 64 bytes");
+    static_assert(sizeof(SectionEntry) == 24, "section entry layout is part of the format");
+    static_assert(sizeof(TraitsEntry) == 20, "traits entry layout is part of the format");
+    static_assert(sizeof(LinkEntry) == 4, "link entry layout is part of the format");
+    static_assert(sizeof(NodeEntry) == 24, "node entry layout is part of the format");
+
+    uint64_t alignUp(uint64_t offset) {
+        return (offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+    // ========== FILE MAPPING ==========
+
+    void unmapFile(void* base, size_t length) {
+#ifdef _WIN32
+        (void)length;
+        std::free(base);
+#else
+        munmap(base, length);
+#endif
+    }
+
+    /**
+     * @brief Map a whole file copy-on-write (read into memory where mmap is unavailable)
+     */
+    bool mapFile(const std::string& path, void*& base, size_t& length) {
+#ifdef _WIN32
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return false;
+        }
+        length = static_cast<size_t>(file.tellg());
+        base = std::malloc(length ? length : 1);
+        if (!base) {
+            return false;
+        }
+        file.seekg(0);
+        if (!file.read(static_cast<char*>(base), static_cast<std::streamsize>(length))) {
+            std::free(base);
+            return false;
+        }
+        return true;
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            close(fd);
+            return false;
+        }
+        length = static_cast<size_t>(info.st_size);
+        // Private + writable: untouched pages stay shared with the page cache,
+        // written pages are copied and never reach the file
+        base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) {
+            base = nullptr;
+            return false;
+        }
+        return true;
+#endif
+    }
+
+    // ========== IMAGE BUILDING ==========
+
+    /**
+     * @brief Collects the plants, strings and flattened tree of an image being saved
+     */
+    class ImageBuilder {
+    public:
+        std::vector<const Plant*> plants;
+        std::unordered_map<const Plant*, uint32_t> plantIndex;
+        std::vector<std::string> strings;
+        std::unordered_map<std::string, uint32_t> stringIndex;
+        std::vector<NodeEntry> nodes;
+
+        uint32_t addPlant(const Plant* plant) {
+            if (!plant) {
+                return NONE;
+            }
+            auto it = plantIndex.find(plant);
+            if (it != plantIndex.end()) {
+                return it->second;
+            }
+            uint32_t index = static_cast<uint32_t>(plants.size());
+            plants.push_back(plant);
+            plantIndex.emplace(plant, index);
+            return index;
+        }
+
+        uint32_t addString(const std::string& value) {
+            auto it = stringIndex.find(value);
+            if (it != stringIndex.end()) {
+                return it->second;
+            }
+            uint32_t index = static_cast<uint32_t>(strings.size());
+            strings.push_back(value);
+            stringIndex.emplace(value, index);
+            return index;
+        }
+
+        bool addTree(const FlatGreenhouseTree& tree) {
+            nodes.reserve(nodes.size() + tree.size());
+            for (size_t row = 0; row < tree.size(); row++) {
+                const GreenhouseComponent* component = tree.getComponent(row);
+                NodeEntry node = {};
+                node.parent = tree.getParent(row) == FlatGreenhouseTree::NONE ? NONE : tree.getParent(row);
+                node.name = addString(component->getName());
+                node.sectionType = NONE;
+                node.plant = NONE;
+
+                switch (tree.getKind(row)) {
+                    case GreenhouseNodeKind::Plant:
+                        node.kind = NODE_LEAF;
+                        node.plant = addPlant(tree.getPlant(row));
+                        break;
+                    case GreenhouseNodeKind::Shelf:
+                        node.kind = NODE_SHELF;
+                        node.number = static_cast<const Shelf*>(component)->getShelfNumber();
+                        break;
+                    case GreenhouseNodeKind::Section:
+                        node.kind = NODE_SECTION;
+                        node.sectionType = addString(static_cast<const GreenhouseSection*>(component)->getSectionType());
+                        break;
+                    case GreenhouseNodeKind::Greenhouse:
+                        node.kind = NODE_GREENHOUSE;
+                        break;
+                    default:
+                        LOG_ERROR("Mapped snapshot: cannot save component '" << component->getName() << "'");
+                        return false;
+                }
+                nodes.push_back(node);
+            }
+            return true;
+        }
+    };
+
+    struct PendingSection {
+        uint32_t id;
+        uint32_t elementSize;
+        uint64_t count;
+        std::vector<unsigned char> bytes;
+    };
+
+    template <typename T>
+    PendingSection makeSection(uint32_t id, const std::vector<T>& values) {
+        PendingSection section;
+        section.id = id;
+        section.elementSize = sizeof(T);
+        section.count = values.size();
+        section.bytes.resize(values.size() * sizeof(T));
+        if (!values.empty()) {
+            std::memcpy(section.bytes.data(), values.data(), section.bytes.size());
+        }
+        return section;
+    }
+}
+
+// ========== SAVE ==========
+
+bool MappedSnapshot::save(const std::string& path, const std::vector<Plant*>& plants,
+                          const GreenhouseInventory* inventory, const GreenhouseComponent* root) {
+    ImageBuilder image;
+    for (const Plant* plant : plants) {
+        image.addPlant(plant);
+    }
+
+    std::vector<uint32_t> order;
+    if (inventory) {
+        order.reserve(inventory->getCount());
+        for (size_t i = 0; i < inventory->getCount(); i++) {
+            if (Plant* plant = inventory->getPlantAt(i)) {
+                order.push_back(image.addPlant(plant));
+            }
+        }
+    }
+    if (root && !image.addTree(FlatGreenhouseTree(root))) {
+        return false;
+    }
+
+    const size_t count = image.plants.size();
+    std::vector<PendingSection> sections;
+    sections.reserve(SECTION_LIMIT);
+
+    // Columns, gathered into saved order (plant i of the image is slot i on load)
+    auto addColumn = [&](uint32_t id, auto PlantStore::* column) {
+        using Value = std::remove_reference_t<decltype((PlantStore::getInstance().*column)[0])>;
+        std::vector<Value> values(count);
+        for (size_t i = 0; i < count; i++) {
+            const Plant* plant = image.plants[i];
+            values[i] = (plant->store->*column)[plant->slot];
+        }
+        sections.push_back(makeSection(id, values));
+    };
+    addColumn(COLUMN_AGE, &PlantStore::age);
+    addColumn(COLUMN_CURRENT_GROWTH_DAYS, &PlantStore::currentGrowthDays);
+    addColumn(COLUMN_DAYS_TO_MATURITY, &PlantStore::daysToMaturity);
+    addColumn(COLUMN_HEALTH_LEVEL, &PlantStore::healthLevel);
+    addColumn(COLUMN_HEIGHT, &PlantStore::height);
+    addColumn(COLUMN_WATERING_FREQUENCY, &PlantStore::wateringFrequency);
+    addColumn(COLUMN_FERTILIZING_FREQUENCY, &PlantStore::fertilizingFrequency);
+    addColumn(COLUMN_TIMES_WATERED, &PlantStore::timesWatered);
+    addColumn(COLUMN_TIMES_FERTILIZED, &PlantStore::timesFertilized);
+    addColumn(COLUMN_READY_FOR_SALE, &PlantStore::readyForSale);
+    addColumn(COLUMN_PLANT_ID, &PlantStore::plantId);
+    addColumn(COLUMN_BASE_PRICE, &PlantStore::basePrice);
+    addColumn(COLUMN_SUNLIGHT_REQUIREMENT, &PlantStore::sunlightRequirement);
+    addColumn(COLUMN_TIMES_PRUNED, &PlantStore::timesPruned);
+    addColumn(COLUMN_SHELF_NUMBER, &PlantStore::shelfNumber);
+    addColumn(COLUMN_LAST_WATERED, &PlantStore::lastWatered);
+    addColumn(COLUMN_LAST_FERTILIZED, &PlantStore::lastFertilized);
+    addColumn(COLUMN_LAST_PRUNED, &PlantStore::lastPruned);
+
+    // Handle data: one traits entry per (type, traits) combination
+    std::map<std::pair<uint32_t, const SpeciesTraits*>, uint32_t> traitsIndex;
+    std::vector<TraitsEntry> traitsTable;
+    std::vector<uint32_t> plantTraits(count);
+    std::vector<uint32_t> plantLocation(count);
+    std::vector<LinkEntry> plantLinks(count);
+    for (size_t i = 0; i < count; i++) {
+        const Plant* plant = image.plants[i];
+        std::pair<uint32_t, const SpeciesTraits*> key(image.addString(plant->getType()), plant->traits);
+        auto it = traitsIndex.find(key);
+        if (it == traitsIndex.end()) {
+            TraitsEntry entry = {key.first, image.addString(plant->getSpecies()),
+                                 image.addString(plant->getScientificName()),
+                                 image.addString(plant->getSoilType()),
+                                 image.addString(plant->getCurrentSeason())};
+            it = traitsIndex.emplace(key, static_cast<uint32_t>(traitsTable.size())).first;
+            traitsTable.push_back(entry);
+        }
+        plantTraits[i] = it->second;
+        plantLocation[i] = image.addString(plant->location);
+        plantLinks[i].state = PlantSnapshot::stateId(plant->currentState);
+        plantLinks[i].strategy = PlantSnapshot::strategyId(plant->careStrategy);
+        plantLinks[i].routine = PlantSnapshot::routineId(plant->careRoutine);
+        plantLinks[i].reserved = 0;
+    }
+    sections.push_back(makeSection(PLANT_TRAITS, plantTraits));
+    sections.push_back(makeSection(PLANT_LOCATION, plantLocation));
+    sections.push_back(makeSection(PLANT_LINKS, plantLinks));
+    sections.push_back(makeSection(TRAITS_TABLE, traitsTable));
+
+    std::vector<uint64_t> stringOffsets;
+    std::vector<char> stringBytes;
+    stringOffsets.reserve(image.strings.size() + 1);
+    for (const std::string& value : image.strings) {
+        stringOffsets.push_back(stringBytes.size());
+        stringBytes.insert(stringBytes.end(), value.begin(), value.end());
+    }
+    stringOffsets.push_back(stringBytes.size());
+    sections.push_back(makeSection(STRING_OFFSETS, stringOffsets));
+    sections.push_back(makeSection(STRING_BYTES, stringBytes));
+
+    sections.push_back(makeSection(INVENTORY_ORDER, order));
+    sections.push_back(makeSection(TREE_NODES, image.nodes));
+
+    // Layout: header, directory, then each section on its own aligned offset
+    std::vector<SectionEntry> directory;
+    uint64_t offset = alignUp(sizeof(Header) + sections.size() * sizeof(SectionEntry));
+    uint64_t end = offset;
+    for (const PendingSection& section : sections) {
+        directory.push_back({section.id, section.elementSize, offset, section.count});
+        end = offset + section.bytes.size();
+        offset = alignUp(end);
+    }
+
+    Header header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.sectionCount = static_cast<uint16_t>(sections.size());
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.plantCount = count;
+    header.fileSize = end;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        LOG_ERROR("Mapped snapshot: cannot open '" << path << "' for writing");
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(directory.data()),
+               static_cast<std::streamsize>(directory.size() * sizeof(SectionEntry)));
+
+    uint64_t written = sizeof(Header) + directory.size() * sizeof(SectionEntry);
+    const char padding[ALIGNMENT] = {};
+    for (size_t k = 0; k < sections.size(); k++) {
+        file.write(padding, static_cast<std::streamsize>(directory[k].offset - written));
+        file.write(reinterpret_cast<const char*>(sections[k].bytes.data()),
+                   static_cast<std::streamsize>(sections[k].bytes.size()));
+        written = directory[k].offset + sections[k].bytes.size();
+    }
+    file.flush();
+
+    if (!file) {
+        LOG_ERROR("Mapped snapshot: failed writing '" << path << "'");
+        return false;
+    }
+    return true;
+}
+
+// ========== LOAD ==========
+
+bool MappedSnapshot::load(const std::string& path, std::vector<Plant*>& plants,
+                          GreenhouseInventory* inventory, GreenhouseComponent** root) {
+    if (root) {
+        *root = nullptr;
+    }
+
+    void* mapped = nullptr;
+    size_t length = 0;
+    if (!mapFile(path, mapped, length)) {
+        LOG_ERROR("Mapped snapshot: cannot map '" << path << "'");
+        return false;
+    }
+    unsigned char* base = static_cast<unsigned char*>(mapped);
+
+    auto fail = [&](const char* reason) {
+        LOG_ERROR("Mapped snapshot: " << reason << " in '" << path << "'");
+        unmapFile(mapped, length);
+        return false;
+    };
+
+    // ---- Header and directory ----
+    if (length < sizeof(Header)) {
+        return fail("missing header");
+    }
+    const Header* header = reinterpret_cast<const Header*>(base);
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0) {
+        return fail("bad magic");
+    }
+    if (header->byteOrder != BYTE_ORDER_MARK) {
+        return fail("foreign byte order");
+    }
+    if (header->version == 0 || header->version > FORMAT_VERSION) {
+        return fail("unsupported format version");
+    }
+    if (header->fileSize != length ||
+        sizeof(Header) + header->sectionCount * sizeof(SectionEntry) > length) {
+        return fail("truncated image");
+    }
+
+    const SectionEntry* sections[SECTION_LIMIT] = {};
+    const SectionEntry* directory = reinterpret_cast<const SectionEntry*>(base + sizeof(Header));
+    for (uint16_t k = 0; k < header->sectionCount; k++) {
+        const SectionEntry& entry = directory[k];
+        if (entry.id == 0 || entry.id >= SECTION_LIMIT || sections[entry.id] ||
+            entry.offset % ALIGNMENT != 0 || entry.offset > length || entry.elementSize == 0 ||
+            entry.count > (length - entry.offset) / entry.elementSize) {
+            return fail("bad section directory");
+        }
+        sections[entry.id] = &entry;
+    }
+
+    const uint64_t count = header->plantCount;
+    auto sectionData = [&](uint32_t id, size_t elementSize, uint64_t expected, uint64_t& found) -> void* {
+        const SectionEntry* entry = sections[id];
+        if (!entry || entry->elementSize != elementSize ||
+            (expected != ANY_COUNT && entry->count != expected)) {
+            return nullptr;
+        }
+        found = entry->count;
+        return base + entry->offset;
+    };
+
+    // ---- Validate everything before the store is touched ----
+    uint64_t found = 0;
+    for (uint32_t id = COLUMN_AGE; id <= COLUMN_LAST_PRUNED; id++) {
+        if (!sections[id] || sections[id]->count != count) {
+            return fail("missing store column");
+        }
+    }
+
+    const uint64_t* stringOffsets = static_cast<const uint64_t*>(
+        sectionData(STRING_OFFSETS, sizeof(uint64_t), ANY_COUNT, found));
+    uint64_t stringCount = found ? found - 1 : 0;
+    uint64_t byteCount = 0;
+    const char* stringBytes = static_cast<const char*>(sectionData(STRING_BYTES, 1, ANY_COUNT, byteCount));
+    if (!stringOffsets || !stringBytes || found == 0) {
+        return fail("missing string pool");
+    }
+    for (uint64_t k = 0; k < stringCount; k++) {
+        if (stringOffsets[k] > stringOffsets[k + 1] || stringOffsets[k + 1] > byteCount) {
+            return fail("bad string pool");
+        }
+    }
+
+    uint64_t traitsCount = 0;
+    const TraitsEntry* traitsTable = static_cast<const TraitsEntry*>(
+        sectionData(TRAITS_TABLE, sizeof(TraitsEntry), ANY_COUNT, traitsCount));
+    const uint32_t* plantTraits = static_cast<const uint32_t*>(
+        sectionData(PLANT_TRAITS, sizeof(uint32_t), count, found));
+    const uint32_t* plantLocation = static_cast<const uint32_t*>(
+        sectionData(PLANT_LOCATION, sizeof(uint32_t), count, found));
+    const LinkEntry* plantLinks = static_cast<const LinkEntry*>(
+        sectionData(PLANT_LINKS, sizeof(LinkEntry), count, found));
+    uint64_t orderCount = 0;
+    const uint32_t* order = static_cast<const uint32_t*>(
+        sectionData(INVENTORY_ORDER, sizeof(uint32_t), ANY_COUNT, orderCount));
+    uint64_t nodeCount = 0;
+    const NodeEntry* nodes = static_cast<const NodeEntry*>(
+        sectionData(TREE_NODES, sizeof(NodeEntry), ANY_COUNT, nodeCount));
+    if ((count && (!plantTraits || !plantLocation || !plantLinks)) || (traitsCount && !traitsTable) ||
+        (orderCount && !order) || (nodeCount && !nodes)) {
+        return fail("missing section");
+    }
+
+    std::vector<std::string> strings(stringCount);
+    for (uint64_t k = 0; k < stringCount; k++) {
+        strings[k].assign(stringBytes + stringOffsets[k], stringOffsets[k + 1] - stringOffsets[k]);
+    }
+
+    std::vector<PlantFactory*> factories(traitsCount, nullptr);
+    for (uint64_t t = 0; t < traitsCount; t++) {
+        const TraitsEntry& entry = traitsTable[t];
+        if (entry.type >= stringCount || entry.species >= stringCount ||
+            entry.scientificName >= stringCount || entry.soilType >= stringCount ||
+            entry.season >= stringCount) {
+            return fail("bad traits entry");
+        }
+        factories[t] = PlantSnapshot::factoryFor(strings[entry.type]);
+        if (!factories[t]) {
+            return fail("unknown plant type");
+        }
+    }
+    for (uint64_t i = 0; i < count; i++) {
+        if (plantTraits[i] >= traitsCount || plantLocation[i] >= stringCount) {
+            return fail("bad plant reference");
+        }
+    }
+    for (uint64_t k = 0; k < orderCount; k++) {
+        if (order[k] >= count) {
+            return fail("bad inventory entry");
+        }
+    }
+    for (uint64_t k = 0; k < nodeCount; k++) {
+        const NodeEntry& node = nodes[k];
+        bool parentOk = k == 0 ? node.parent == NONE
+                               : node.parent < k && nodes[node.parent].kind != NODE_LEAF;
+        if (!parentOk || node.kind < NODE_GREENHOUSE || node.kind > NODE_LEAF ||
+            node.name >= stringCount || (node.kind == NODE_SECTION && node.sectionType >= stringCount) ||
+            (node.plant != NONE && node.plant >= count)) {
+            return fail("bad tree node");
+        }
+    }
+
+    // ---- Columns: used in place if the store is empty, appended otherwise ----
+    PlantStore& store = PlantStore::getInstance();
+    const size_t first = store.capacity();
+    const bool inPlace = first == 0 && count > 0 && !store.isMapped();
+
+    auto forEachColumn = [&](auto&& visit) {
+        return visit(COLUMN_AGE, store.age) &&
+               visit(COLUMN_CURRENT_GROWTH_DAYS, store.currentGrowthDays) &&
+               visit(COLUMN_DAYS_TO_MATURITY, store.daysToMaturity) &&
+               visit(COLUMN_HEALTH_LEVEL, store.healthLevel) &&
+               visit(COLUMN_HEIGHT, store.height) &&
+               visit(COLUMN_WATERING_FREQUENCY, store.wateringFrequency) &&
+               visit(COLUMN_FERTILIZING_FREQUENCY, store.fertilizingFrequency) &&
+               visit(COLUMN_TIMES_WATERED, store.timesWatered) &&
+               visit(COLUMN_TIMES_FERTILIZED, store.timesFertilized) &&
+               visit(COLUMN_READY_FOR_SALE, store.readyForSale) &&
+               visit(COLUMN_PLANT_ID, store.plantId) &&
+               visit(COLUMN_BASE_PRICE, store.basePrice) &&
+               visit(COLUMN_SUNLIGHT_REQUIREMENT, store.sunlightRequirement) &&
+               visit(COLUMN_TIMES_PRUNED, store.timesPruned) &&
+               visit(COLUMN_SHELF_NUMBER, store.shelfNumber) &&
+               visit(COLUMN_LAST_WATERED, store.lastWatered) &&
+               visit(COLUMN_LAST_FERTILIZED, store.lastFertilized) &&
+               visit(COLUMN_LAST_PRUNED, store.lastPruned);
+    };
+    bool sizesMatch = forEachColumn([&](uint32_t id, auto& column) {
+        return sections[id]->elementSize == sizeof(column[0]);
+    });
+    if (!sizesMatch) {
+        return fail("column element size mismatch");
+    }
+    forEachColumn([&](uint32_t id, auto& column) {
+        using Value = std::remove_reference_t<decltype(column[0])>;
+        Value* values = reinterpret_cast<Value*>(base + sections[id]->offset);
+        if (inPlace) {
+            column.wrap(values, count);
+        } else if (count > 0) {
+            column.append(values, count);
+        }
+        return true;
+    });
+    store.owner.resize(first + count, nullptr);
+    store.generation.resize(first + count, 0);
+
+    // ---- Handles: bound to the restored slots without resetting them ----
+    std::vector<const SpeciesTraits*> traits(traitsCount, nullptr);
+    const size_t firstPlant = plants.size();
+    plants.reserve(firstPlant + count);
+    for (uint64_t i = 0; i < count; i++) {
+        uint32_t t = plantTraits[i];
+        store.adoptNextAllocation(first + i);
+        Plant* plant = factories[t]->createPlant();
+        store.takeAdoptedAllocation();
+
+        if (!traits[t]) {
+            const TraitsEntry& entry = traitsTable[t];
+            traits[t] = PlantSnapshot::resolveTraits(plant->traits, strings[entry.species],
+                                                     strings[entry.scientificName],
+                                                     strings[entry.soilType], strings[entry.season]);
+        }
+        plant->traits = traits[t];
+        plant->location = strings[plantLocation[i]];
+
+        const LinkEntry& links = plantLinks[i];
+        if (links.state != OTHER) plant->currentState = PlantSnapshot::stateFor(links.state);
+        if (links.strategy != OTHER) plant->careStrategy = PlantSnapshot::strategyFor(links.strategy);
+        if (links.routine != OTHER) plant->careRoutine = PlantSnapshot::routineFor(links.routine);
+        plants.push_back(plant);
+    }
+
+    if (inventory) {
+        for (uint64_t k = 0; k < orderCount; k++) {
+            inventory->addPlant(plants[firstPlant + order[k]]);
+        }
+    }
+
+    if (root && nodeCount > 0) {
+        std::vector<GreenhouseComponent*> built(nodeCount, nullptr);
+        for (uint64_t k = 0; k < nodeCount; k++) {
+            const NodeEntry& node = nodes[k];
+            const std::string& name = strings[node.name];
+            switch (node.kind) {
+                case NODE_GREENHOUSE:
+                    built[k] = new Greenhouse(name);
+                    break;
+                case NODE_SECTION:
+                    built[k] = new GreenhouseSection(strings[node.sectionType], name);
+                    break;
+                case NODE_SHELF:
+                    built[k] = new Shelf(node.number, name);
+                    break;
+                default:
+                    built[k] = new PlantLeaf(node.plant == NONE ? nullptr : plants[firstPlant + node.plant],
+                                             name);
+                    break;
+            }
+            if (k > 0) {
+                built[node.parent]->add(built[k]);
+            }
+        }
+        *root = built[0];
+    }
+
+    if (inPlace) {
+        // The store keeps the image alive for as long as its columns point into it
+        store.mappedBase = mapped;
+        store.mappedLength = length;
+        store.mappedRelease = unmapFile;
+    } else {
+        unmapFile(mapped, length);
+    }
+    return true;
+}
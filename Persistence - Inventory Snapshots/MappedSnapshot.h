@@ -0,0 +1,68 @@
+#ifndef MAPPEDSNAPSHOT_H
+#define MAPPEDSNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Plant;
+class GreenhouseInventory;
+class GreenhouseComponent;
+
+/**
+ * @brief Fixed-layout greenhouse image that is memory-mapped at startup
+ *
+ * Unlike PlantSnapshot, which encodes portable records that are parsed one by
+ * one, this format stores the PlantStore columns exactly as they sit in memory
+ * (native byte order, 64-byte aligned sections). Loading maps the file and,
+ * when the store is still empty, points the columns straight at the mapped
+ * pages - nothing is parsed or copied. The mapping is private, so the pages a
+ * simulation step writes to are copied on first write and the file itself is
+ * never modified.
+ *
+ * Besides the columns the image holds the species traits table, a string pool,
+ * the inventory order and the composite tree (flattened in pre-order), so a
+ * whole greenhouse comes back from one file.
+ *
+ * File layout:
+ *   char[8] magic "NJDMMAP1", u16 version, u16 sectionCount,
+ *   u32 byte-order mark, u64 plantCount, u64 fileSize, padding to 64 bytes,
+ *   { u32 id, u32 elementSize, u64 offset, u64 count }[sectionCount],
+ *   sections (each 64-byte aligned)
+ *
+ * Images are only readable on a machine with the same byte order.
+ */
+class MappedSnapshot {
+public:
+    static constexpr uint16_t FORMAT_VERSION = 1;
+
+    /**
+     * @brief Write an image of the given plants, inventory order and tree
+     * @param plants Plants to save; plants reachable from the inventory or the
+     *        tree are saved as well
+     * @param inventory Inventory whose order is recorded (may be nullptr)
+     * @param root Composite tree to flatten (may be nullptr)
+     * @return false if the file could not be written or the tree holds an unknown component
+     */
+    static bool save(const std::string& path, const std::vector<Plant*>& plants,
+                     const GreenhouseInventory* inventory = nullptr,
+                     const GreenhouseComponent* root = nullptr);
+
+    /**
+     * @brief Map an image and bind plant handles to its columns
+     *
+     * The columns are used in place when the default PlantStore is empty;
+     * otherwise they are appended to it and the file is unmapped again.
+     *
+     * @param plants Receives the new plants in saved order (caller takes ownership)
+     * @param inventory Receives the saved inventory order (may be nullptr)
+     * @param root Receives the rebuilt tree, or nullptr if none was saved (may be nullptr)
+     * @return false if the file is missing, corrupt or of an unknown version
+     */
+    static bool load(const std::string& path, std::vector<Plant*>& plants,
+                     GreenhouseInventory* inventory = nullptr,
+                     GreenhouseComponent** root = nullptr);
+};
+
+#endif // MAPPEDSNAPSHOT_H
@@ -0,0 +1,532 @@
+#include "PlantSnapshot.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include "../Plant - Abstract Base/PlantStore.h"
+#include "../Flyweight - Species Traits/SpeciesRegistry.h"
+#include "../Iterator - Inventory Management/GreenhouseInventory.h"
+#include "../Factory - Plant Creation/RoseFactory.h"
+#include "../Factory - Plant Creation/CactusFactory.h"
+#include "../Factory - Plant Creation/LavenderFactory.h"
+#include "../Factory - Plant Creation/SucculentFactory.h"
+#include "../Factory - Plant Creation/BaobabFactory.h"
+#include "../State - Plant lifecycle/SeedlingState.h"
+#include "../State - Plant lifecycle/GrowingState.h"
+#include "../State - Plant lifecycle/MatureState.h"
+#include "../State - Plant lifecycle/FloweringState.h"
+#include "../State - Plant lifecycle/DormantState.h"
+#include "../Strategy - Watering Methods/FrequentWatering.h"
+#include "../Strategy - Watering Methods/ModerateWatering.h"
+#include "../Strategy - Watering Methods/MinimalWatering .h"
+#include "../Template- Plant Care/RoseCare.h"
+#include "../Template- Plant Care/SucculentCare.h"
+#include "../Template- Plant Care/TreeCare.h"
+#include "../Core - Simulation Services/Logger.h"
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+
+namespace {
+    const char INVENTORY_MAGIC[8] = {'N', 'J', 'D', 'S', 'N', 'A', 'P', '1'};
+    const char PLANT_MAGIC[4] = {'N', 'J', 'D', 'P'};
+
+    const size_t HEADER_SIZE = 8 + 2 + 2 + 4 + 8 + 4;
+    const size_t FIELDS_SIZE = 12 * 4 + 2 * 8 + 3 * 8 + 4;   // Numeric part of a record
+    const size_t STRING_REFS = 6;                            // type, species, scientific name, soil, season, location
+    const size_t RECORD_SIZE = STRING_REFS * 4 + FIELDS_SIZE;
+    const size_t BUFFER_SIZE = 4 * 1024 * 1024;
+
+    const uint8_t NONE = 0;
+    const uint8_t OTHER = 255;   // Set, but not a type the format knows how to restore
+
+    // ========== LITTLE-ENDIAN ENCODING ==========
+
+    void putU8(std::string& out, uint8_t value) {
+        out.push_back(static_cast<char>(value));
+    }
+
+    void putU16(std::string& out, uint16_t value) {
+        char bytes[2] = {static_cast<char>(value), static_cast<char>(value >> 8)};
+        out.append(bytes, 2);
+    }
+
+    void putU32(std::string& out, uint32_t value) {
+        char bytes[4];
+        for (int i = 0; i < 4; i++) {
+            bytes[i] = static_cast<char>(value >> (8 * i));
+        }
+        out.append(bytes, 4);
+    }
+
+    void putU64(std::string& out, uint64_t value) {
+        char bytes[8];
+        for (int i = 0; i < 8; i++) {
+            bytes[i] = static_cast<char>(value >> (8 * i));
+        }
+        out.append(bytes, 8);
+    }
+
+    void putF64(std::string& out, double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        putU64(out, bits);
+    }
+
+    void putString(std::string& out, const std::string& value) {
+        putU32(out, static_cast<uint32_t>(value.size()));
+        out.append(value);
+    }
+
+    uint16_t getU16(const unsigned char* in) {
+        return static_cast<uint16_t>(in[0] | (in[1] << 8));
+    }
+
+    uint32_t getU32(const unsigned char* in) {
+        return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8) |
+               (static_cast<uint32_t>(in[2]) << 16) | (static_cast<uint32_t>(in[3]) << 24);
+    }
+
+    uint64_t getU64(const unsigned char* in) {
+        return static_cast<uint64_t>(getU32(in)) | (static_cast<uint64_t>(getU32(in + 4)) << 32);
+    }
+
+    double getF64(const unsigned char* in) {
+        uint64_t bits = getU64(in);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief Bounds-checked cursor over a single-plant record
+     */
+    class RecordReader {
+    private:
+        const unsigned char* data;
+        size_t size;
+        size_t pos;
+
+    public:
+        RecordReader(const std::string& bytes)
+            : data(reinterpret_cast<const unsigned char*>(bytes.data())), size(bytes.size()), pos(0) {}
+
+        const unsigned char* take(size_t count) {
+            if (size - pos < count) {
+                return nullptr;
+            }
+            const unsigned char* at = data + pos;
+            pos += count;
+            return at;
+        }
+
+        bool getString(std::string& value) {
+            const unsigned char* length = take(4);
+            if (!length) {
+                return false;
+            }
+            const unsigned char* bytes = take(getU32(length));
+            if (!bytes) {
+                return false;
+            }
+            value.assign(reinterpret_cast<const char*>(bytes), getU32(length));
+            return true;
+        }
+    };
+}
+
+// ========== SHARED IDENTIFIERS ==========
+
+uint8_t PlantSnapshot::stateId(const PlantState* state) {
+    if (!state) return NONE;
+    std::string name = state->getStateName();
+    if (name == "Seedling") return 1;
+    if (name == "Growing") return 2;
+    if (name == "Mature") return 3;
+    if (name == "Flowering") return 4;
+    if (name == "Dormant") return 5;
+    return OTHER;
+}
+
+PlantState* PlantSnapshot::stateFor(uint8_t id) {
+    // States hold no data, so restored plants share one instance of each
+    static SeedlingState seedling;
+    static GrowingState growing;
+    static MatureState mature;
+    static FloweringState flowering;
+    static DormantState dormant;
+    switch (id) {
+        case 1: return &seedling;
+        case 2: return &growing;
+        case 3: return &mature;
+        case 4: return &flowering;
+        case 5: return &dormant;
+        default: return nullptr;
+    }
+}
+
+uint8_t PlantSnapshot::strategyId(PlantCareStrategy* strategy) {
+    if (!strategy) return NONE;
+    if (dynamic_cast<FrequentWatering*>(strategy)) return 1;
+    if (dynamic_cast<ModerateWatering*>(strategy)) return 2;
+    if (dynamic_cast<MinimalWatering*>(strategy)) return 3;
+    return OTHER;
+}
+
+PlantCareStrategy* PlantSnapshot::strategyFor(uint8_t id) {
+    static FrequentWatering frequent;
+    static ModerateWatering moderate;
+    static MinimalWatering minimal;
+    switch (id) {
+        case 1: return &frequent;
+        case 2: return &moderate;
+        case 3: return &minimal;
+        default: return nullptr;
+    }
+}
+
+uint8_t PlantSnapshot::routineId(PlantCareRoutine* routine) {
+    if (!routine) return NONE;
+    if (dynamic_cast<RoseCare*>(routine)) return 1;
+    if (dynamic_cast<SucculentCare*>(routine)) return 2;
+    if (dynamic_cast<TreeCare*>(routine)) return 3;
+    return OTHER;
+}
+
+PlantCareRoutine* PlantSnapshot::routineFor(uint8_t id) {
+    static RoseCare rose;
+    static SucculentCare succulent;
+    static TreeCare tree;
+    switch (id) {
+        case 1: return &rose;
+        case 2: return &succulent;
+        case 3: return &tree;
+        default: return nullptr;
+    }
+}
+
+PlantFactory* PlantSnapshot::factoryFor(const std::string& type) {
+    static RoseFactory rose;
+    static CactusFactory cactus;
+    static LavenderFactory lavender;
+    static SucculentFactory succulent;
+    static BaobabFactory baobab;
+    if (type == "Rose") return &rose;
+    if (type == "Cactus") return &cactus;
+    if (type == "Lavender") return &lavender;
+    if (type == "Succulent") return &succulent;
+    if (type == "Baobab") return &baobab;
+    return nullptr;
+}
+
+const SpeciesTraits* PlantSnapshot::resolveTraits(const SpeciesTraits* base, const std::string& species,
+                                                 const std::string& scientificName,
+                                                 const std::string& soil, const std::string& season) {
+    if (base->getSpecies() == species && base->getScientificName() == scientificName &&
+        base->getSoilType() == soil && base->getSeason() == season) {
+        return base;
+    }
+    SpeciesTraits variant = base->withSpecies(species).withScientificName(scientificName)
+                                .withSoilType(soil).withSeason(season);
+    return SpeciesRegistry::getInstance().intern(variant);
+}
+
+// ========== RECORD FIELDS ==========
+
+void PlantSnapshot::putFields(std::string& out, const Plant& plant) {
+    const PlantStore& s = *plant.store;
+    const size_t i = plant.slot;
+    putU32(out, static_cast<uint32_t>(s.plantId[i]));
+    putU32(out, static_cast<uint32_t>(s.age[i]));
+    putU32(out, static_cast<uint32_t>(s.currentGrowthDays[i]));
+    putU32(out, static_cast<uint32_t>(s.daysToMaturity[i]));
+    putU32(out, static_cast<uint32_t>(s.healthLevel[i]));
+    putU32(out, static_cast<uint32_t>(s.wateringFrequency[i]));
+    putU32(out, static_cast<uint32_t>(s.sunlightRequirement[i]));
+    putU32(out, static_cast<uint32_t>(s.fertilizingFrequency[i]));
+    putU32(out, static_cast<uint32_t>(s.timesWatered[i]));
+    putU32(out, static_cast<uint32_t>(s.timesFertilized[i]));
+    putU32(out, static_cast<uint32_t>(s.timesPruned[i]));
+    putU32(out, static_cast<uint32_t>(s.shelfNumber[i]));
+    putF64(out, s.height[i]);
+    putF64(out, s.basePrice[i]);
+    putU64(out, static_cast<uint64_t>(s.lastWatered[i]));
+    putU64(out, static_cast<uint64_t>(s.lastFertilized[i]));
+    putU64(out, static_cast<uint64_t>(s.lastPruned[i]));
+    putU8(out, s.readyForSale[i]);
+    putU8(out, stateId(plant.currentState));
+    putU8(out, strategyId(plant.careStrategy));
+    putU8(out, routineId(plant.careRoutine));
+}
+
+void PlantSnapshot::getFields(const unsigned char* in, Plant& plant) {
+    PlantStore& s = *plant.store;
+    const size_t i = plant.slot;
+    s.plantId[i] = static_cast<int32_t>(getU32(in));
+    s.age[i] = static_cast<int32_t>(getU32(in + 4));
+    s.currentGrowthDays[i] = static_cast<int32_t>(getU32(in + 8));
+    s.daysToMaturity[i] = static_cast<int32_t>(getU32(in + 12));
+    s.healthLevel[i] = static_cast<int32_t>(getU32(in + 16));
+    s.wateringFrequency[i] = static_cast<int32_t>(getU32(in + 20));
+    s.sunlightRequirement[i] = static_cast<int32_t>(getU32(in + 24));
+    s.fertilizingFrequency[i] = static_cast<int32_t>(getU32(in + 28));
+    s.timesWatered[i] = static_cast<int32_t>(getU32(in + 32));
+    s.timesFertilized[i] = static_cast<int32_t>(getU32(in + 36));
+    s.timesPruned[i] = static_cast<int32_t>(getU32(in + 40));
+    s.shelfNumber[i] = static_cast<int32_t>(getU32(in + 44));
+    s.height[i] = getF64(in + 48);
+    s.basePrice[i] = getF64(in + 56);
+    s.lastWatered[i] = static_cast<int64_t>(getU64(in + 64));
+    s.lastFertilized[i] = static_cast<int64_t>(getU64(in + 72));
+    s.lastPruned[i] = static_cast<int64_t>(getU64(in + 80));
+    s.readyForSale[i] = in[88] ? 1 : 0;
+
+    // Identifiers the format does not know (OTHER) leave the current link alone
+    if (in[89] != OTHER) plant.currentState = stateFor(in[89]);
+    if (in[90] != OTHER) plant.careStrategy = strategyFor(in[90]);
+    if (in[91] != OTHER) plant.careRoutine = routineFor(in[91]);
+
+    s.careChangedAll(i);
+}
+
+void PlantSnapshot::setShared(Plant& plant, const SpeciesTraits* traits, const std::string& location) {
+    plant.traits = traits;
+    plant.location = location;
+}
+
+// ========== SINGLE PLANT ==========
+
+std::string PlantSnapshot::encodePlant(const Plant& plant) {
+    std::string out;
+    out.reserve(4 + 2 + FIELDS_SIZE + 128);
+    out.append(PLANT_MAGIC, sizeof(PLANT_MAGIC));
+    putU16(out, FORMAT_VERSION);
+    putString(out, plant.getType());
+    putString(out, plant.getSpecies());
+    putString(out, plant.getScientificName());
+    putString(out, plant.getSoilType());
+    putString(out, plant.getCurrentSeason());
+    putString(out, plant.getLocation());
+    putFields(out, plant);
+    return out;
+}
+
+bool PlantSnapshot::decodePlant(Plant& plant, const std::string& data) {
+    RecordReader reader(data);
+    const unsigned char* magic = reader.take(sizeof(PLANT_MAGIC));
+    const unsigned char* version = reader.take(2);
+    if (!magic || std::memcmp(magic, PLANT_MAGIC, sizeof(PLANT_MAGIC)) != 0 || !version) {
+        return false;
+    }
+    uint16_t formatVersion = getU16(version);
+    if (formatVersion == 0 || formatVersion > FORMAT_VERSION) {
+        return false;
+    }
+
+    std::string strings[STRING_REFS];
+    for (size_t k = 0; k < STRING_REFS; k++) {
+        if (!reader.getString(strings[k])) {
+            return false;
+        }
+    }
+    const unsigned char* fields = reader.take(FIELDS_SIZE);
+    if (!fields) {
+        return false;
+    }
+
+    // strings[0] is the concrete type, which is fixed for an existing plant
+    setShared(plant, resolveTraits(plant.traits, strings[1], strings[2], strings[3], strings[4]),
+              strings[5]);
+    getFields(fields, plant);
+    return true;
+}
+
+// ========== INVENTORY SNAPSHOTS ==========
+
+bool PlantSnapshot::saveInventory(const std::string& path, const std::vector<Plant*>& plants) {
+    // Pass 1: string table (every distinct string once) and per-plant references
+    std::vector<std::string> table;
+    std::unordered_map<std::string, uint32_t> tableIndex;
+    std::unordered_map<const SpeciesTraits*, std::array<uint32_t, 4>> traitsRefs;
+    std::vector<std::array<uint32_t, STRING_REFS>> refs;
+    refs.reserve(plants.size());
+
+    auto intern = [&](const std::string& value) {
+        auto it = tableIndex.find(value);
+        if (it != tableIndex.end()) {
+            return it->second;
+        }
+        uint32_t index = static_cast<uint32_t>(table.size());
+        table.push_back(value);
+        tableIndex.emplace(value, index);
+        return index;
+    };
+
+    std::vector<const Plant*> saved;
+    saved.reserve(plants.size());
+    for (const Plant* plant : plants) {
+        if (!plant) {
+            continue;
+        }
+        auto cached = traitsRefs.find(plant->traits);
+        if (cached == traitsRefs.end()) {
+            std::array<uint32_t, 4> t = {intern(plant->getSpecies()), intern(plant->getScientificName()),
+                                         intern(plant->getSoilType()), intern(plant->getCurrentSeason())};
+            cached = traitsRefs.emplace(plant->traits, t).first;
+        }
+        const std::array<uint32_t, 4>& t = cached->second;
+        refs.push_back({intern(plant->getType()), t[0], t[1], t[2], t[3], intern(plant->location)});
+        saved.push_back(plant);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        LOG_ERROR("Snapshot: cannot open '" << path << "' for writing");
+        return false;
+    }
+
+    std::string buffer;
+    buffer.reserve(BUFFER_SIZE + RECORD_SIZE);
+    buffer.append(INVENTORY_MAGIC, sizeof(INVENTORY_MAGIC));
+    putU16(buffer, FORMAT_VERSION);
+    putU16(buffer, static_cast<uint16_t>(RECORD_SIZE));
+    putU32(buffer, 0);
+    putU64(buffer, saved.size());
+    putU32(buffer, static_cast<uint32_t>(table.size()));
+    for (const std::string& value : table) {
+        putString(buffer, value);
+        if (buffer.size() >= BUFFER_SIZE) {
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+
+    // Pass 2: fixed-size records
+    for (size_t n = 0; n < saved.size(); n++) {
+        for (uint32_t ref : refs[n]) {
+            putU32(buffer, ref);
+        }
+        putFields(buffer, *saved[n]);
+        if (buffer.size() >= BUFFER_SIZE) {
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    file.flush();
+
+    if (!file) {
+        LOG_ERROR("Snapshot: failed writing '" << path << "'");
+        return false;
+    }
+    return true;
+}
+
+bool PlantSnapshot::saveInventory(const std::string& path, const GreenhouseInventory& inventory) {
+    std::vector<Plant*> plants;
+    plants.reserve(inventory.getCount());
+    for (size_t i = 0; i < inventory.getCount(); i++) {
+        plants.push_back(inventory.getPlantAt(i));
+    }
+    return saveInventory(path, plants);
+}
+
+bool PlantSnapshot::loadInventory(const std::string& path, std::vector<Plant*>& plants) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        LOG_ERROR("Snapshot: cannot open '" << path << "'");
+        return false;
+    }
+
+    unsigned char header[HEADER_SIZE];
+    if (!file.read(reinterpret_cast<char*>(header), HEADER_SIZE) ||
+        std::memcmp(header, INVENTORY_MAGIC, sizeof(INVENTORY_MAGIC)) != 0) {
+        LOG_ERROR("Snapshot: '" << path << "' is not an inventory snapshot");
+        return false;
+    }
+    uint16_t version = getU16(header + 8);
+    uint16_t recordSize = getU16(header + 10);
+    uint64_t recordCount = getU64(header + 16);
+    uint32_t stringCount = getU32(header + 24);
+    if (version == 0 || version > FORMAT_VERSION || recordSize != RECORD_SIZE) {
+        LOG_ERROR("Snapshot: unsupported format version " << version << " in '" << path << "'");
+        return false;
+    }
+
+    std::vector<std::string> table(stringCount);
+    for (uint32_t k = 0; k < stringCount; k++) {
+        unsigned char length[4];
+        if (!file.read(reinterpret_cast<char*>(length), 4)) {
+            LOG_ERROR("Snapshot: truncated string table in '" << path << "'");
+            return false;
+        }
+        table[k].resize(getU32(length));
+        if (!file.read(&table[k][0], static_cast<std::streamsize>(table[k].size()))) {
+            LOG_ERROR("Snapshot: truncated string table in '" << path << "'");
+            return false;
+        }
+    }
+
+    PlantStore& store = PlantStore::getInstance();
+    store.reserve(store.capacity() + recordCount);
+    plants.reserve(plants.size() + recordCount);
+
+    std::vector<PlantFactory*> factories(stringCount, nullptr);
+    std::map<std::array<uint32_t, 5>, const SpeciesTraits*> traitsCache;
+
+    const size_t perChunk = BUFFER_SIZE / RECORD_SIZE;
+    std::vector<unsigned char> buffer(perChunk * RECORD_SIZE);
+    uint64_t remaining = recordCount;
+    while (remaining > 0) {
+        size_t batch = remaining < perChunk ? static_cast<size_t>(remaining) : perChunk;
+        if (!file.read(reinterpret_cast<char*>(buffer.data()),
+                       static_cast<std::streamsize>(batch * RECORD_SIZE))) {
+            LOG_ERROR("Snapshot: truncated records in '" << path << "'");
+            return false;
+        }
+
+        for (size_t n = 0; n < batch; n++) {
+            const unsigned char* record = buffer.data() + n * RECORD_SIZE;
+            uint32_t ref[STRING_REFS];
+            for (size_t k = 0; k < STRING_REFS; k++) {
+                ref[k] = getU32(record + 4 * k);
+                if (ref[k] >= stringCount) {
+                    LOG_ERROR("Snapshot: bad string reference in '" << path << "'");
+                    return false;
+                }
+            }
+
+            PlantFactory*& factory = factories[ref[0]];
+            if (!factory) {
+                factory = factoryFor(table[ref[0]]);
+                if (!factory) {
+                    LOG_ERROR("Snapshot: unknown plant type '" << table[ref[0]] << "'");
+                    return false;
+                }
+            }
+
+            Plant* plant = factory->createPlant();
+            std::array<uint32_t, 5> key = {ref[0], ref[1], ref[2], ref[3], ref[4]};
+            auto cached = traitsCache.find(key);
+            if (cached == traitsCache.end()) {
+                const SpeciesTraits* traits = resolveTraits(plant->traits, table[ref[1]], table[ref[2]],
+                                                            table[ref[3]], table[ref[4]]);
+                cached = traitsCache.emplace(key, traits).first;
+            }
+            setShared(*plant, cached->second, table[ref[5]]);
+            getFields(record + STRING_REFS * 4, *plant);
+            plants.push_back(plant);
+        }
+        remaining -= batch;
+    }
+    return true;
+}
+
+bool PlantSnapshot::loadInventory(const std::string& path, GreenhouseInventory& inventory,
+                                  std::vector<Plant*>& owned) {
+    size_t first = owned.size();
+    bool ok = loadInventory(path, owned);
+    for (size_t i = first; i < owned.size(); i++) {
+        inventory.addPlant(owned[i]);
+    }
+    return ok;
+}
@@ -0,0 +1,97 @@
+#ifndef PLANTSNAPSHOT_H
+#define PLANTSNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Plant;
+class GreenhouseInventory;
+class SpeciesTraits;
+class PlantState;
+class PlantCareStrategy;
+class PlantCareRoutine;
+class PlantFactory;
+
+/**
+ * @brief Versioned little-endian binary format for plants and whole inventories
+ *
+ * A plant record covers every Plant field: type, species traits, location,
+ * all store columns (identity, growth, health, care requirements, care
+ * counters and SimulationClock timestamps) and identifiers for the lifecycle
+ * state, care strategy and care routine.
+ *
+ * Single plants (Plant::serialize()) carry their strings inline. Inventory
+ * snapshots hold each distinct string once in a table and then fixed-size
+ * records, streamed through a large buffer in both directions.
+ *
+ * Inventory file layout (all integers little-endian):
+ *   char[8] magic "NJDSNAP1", u16 version, u16 recordSize, u32 reserved,
+ *   u64 recordCount, u32 stringCount, { u32 length, bytes }[stringCount],
+ *   record[recordCount]
+ *
+ * State, strategy and routine identifiers are restored as shared, stateless
+ * instances; the runtime PlantContext link is not persisted.
+ */
+class PlantSnapshot {
+private:
+    // Store columns and shared identifiers, identical in both encodings
+    static void putFields(std::string& out, const Plant& plant);
+    static void getFields(const unsigned char* in, Plant& plant);
+    static void setShared(Plant& plant, const SpeciesTraits* traits, const std::string& location);
+
+    // Shared identifiers: 0 = none, 255 = set but not restorable
+    static uint8_t stateId(const PlantState* state);
+    static PlantState* stateFor(uint8_t id);
+    static uint8_t strategyId(PlantCareStrategy* strategy);
+    static PlantCareStrategy* strategyFor(uint8_t id);
+    static uint8_t routineId(PlantCareRoutine* routine);
+    static PlantCareRoutine* routineFor(uint8_t id);
+    static PlantFactory* factoryFor(const std::string& type);
+
+    // Traits equal to 'base' with the given strings (interned once per combination)
+    static const SpeciesTraits* resolveTraits(const SpeciesTraits* base, const std::string& species,
+                                              const std::string& scientificName,
+                                              const std::string& soil, const std::string& season);
+
+    friend class MappedSnapshot;  // Same identifiers and factories for the mapped format
+
+public:
+    static constexpr uint16_t FORMAT_VERSION = 1;
+
+    /**
+     * @brief Encode one plant as a self-contained binary record
+     */
+    static std::string encodePlant(const Plant& plant);
+
+    /**
+     * @brief Restore a plant's fields from encodePlant() output
+     * @return false (plant unchanged) if the data is truncated or of an unknown version
+     */
+    static bool decodePlant(Plant& plant, const std::string& data);
+
+    /**
+     * @brief Write a snapshot of the given plants
+     * @return false if the file could not be written
+     */
+    static bool saveInventory(const std::string& path, const std::vector<Plant*>& plants);
+    static bool saveInventory(const std::string& path, const GreenhouseInventory& inventory);
+
+    /**
+     * @brief Recreate the plants of a snapshot with the matching species factories
+     * @param plants Receives the new plants (caller takes ownership)
+     * @return false if the file is missing, corrupt or of an unknown version;
+     *         plants created before the error are still appended
+     */
+    static bool loadInventory(const std::string& path, std::vector<Plant*>& plants);
+
+    /**
+     * @brief Load a snapshot and add every plant to an inventory
+     * @param owned Receives the new plants (the inventory does not own them)
+     */
+    static bool loadInventory(const std::string& path, GreenhouseInventory& inventory,
+                              std::vector<Plant*>& owned);
+};
+
+#endif // PLANTSNAPSHOT_H
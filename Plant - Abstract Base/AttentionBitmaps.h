@@ -0,0 +1,59 @@
+#ifndef ATTENTIONBITMAPS_H
+#define ATTENTIONBITMAPS_H
+
+#include "../Iterator - Inventory Management/PositionBitmap.h"
+#include <cstddef>
+
+/**
+ * @brief Reasons Plant::needsAttention() can be true
+ */
+enum class AttentionReason {
+    Water = 0,        // needsWater()
+    Fertilizer = 1,   // needsFertilizer()
+    Pruning = 2,      // needsPruning()
+    Unhealthy = 3     // !isHealthy()
+};
+
+/**
+ * @brief One bitmap per attention reason over the slots of a PlantStore
+ *
+ * Filled in one pass by PlantStore::evaluateAttention(); free slots are never
+ * set. Bit i refers to the plant in slot i (PlantStore::getPlant(i)).
+ */
+class AttentionBitmaps {
+public:
+    static constexpr size_t REASON_COUNT = 4;
+
+private:
+    PositionBitmap reasons[REASON_COUNT];
+
+public:
+    PositionBitmap& get(AttentionReason reason) {
+        return reasons[static_cast<size_t>(reason)];
+    }
+
+    const PositionBitmap& get(AttentionReason reason) const {
+        return reasons[static_cast<size_t>(reason)];
+    }
+
+    /**
+     * @brief Slots with at least one reason (needsAttention())
+     */
+    PositionBitmap any() const {
+        PositionBitmap result = reasons[0];
+        for (size_t i = 1; i < REASON_COUNT; i++) {
+            result.orWith(reasons[i]);
+        }
+        return result;
+    }
+
+    size_t count(AttentionReason reason) const {
+        return get(reason).count();
+    }
+
+    size_t countAny() const {
+        return any().count();
+    }
+};
+
+#endif // ATTENTIONBITMAPS_H
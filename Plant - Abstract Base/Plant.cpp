@@ -1,125 +1,238 @@
 #include "../Plant - Abstract Base/Plant.h"
+#include "PlantStore.h"
+#include "../Command - Staff Functions/CareTimerWheel.h"
+#include "../Core - Simulation Services/SimulationClock.h"
 #include "../Template- Plant Care/PlantCareRoutine.h"
 #include "../State - Plant lifecycle/PlantContext.h"
 #include "../State - Plant lifecycle/PlantState.h"
 #include "../Strategy - Watering Methods/PlantCareStrategy.h"
+#include "../Core - Simulation Services/Logger.h"
+#include "../Flyweight - Species Traits/SpeciesRegistry.h"
+#include "../Persistence - Inventory Snapshots/PlantSnapshot.h"
+#include "../Composite - The Store layout/PlantLeafIndex.h"
+#include "../Composite - The Store layout/PlantLeaf.h"
+#include "../Composite - The Store layout/Shelf.h"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
-#include <ctime>
 
 // ========== CONSTRUCTORS & DESTRUCTOR ==========
 
 Plant::Plant() 
-    : plantId(0), species("Unknown"), scientificName(""), age(0),
-      height(0.0), basePrice(0.0), readyForSale(false), healthLevel(100),
-      wateringFrequency(7), sunlightRequirement(6), fertilizingFrequency(30),
-      soilType("loamy"), daysToMaturity(60), currentGrowthDays(0),
-      currentSeason("spring"), careRoutine(nullptr), context(nullptr),
-      currentState(nullptr), careStrategy(nullptr), shelfNumber(0),
-      timesWatered(0), timesFertilized(0), timesPruned(0) {}
+    : store(&PlantStore::getInstance()), slot(0),
+      traits(SpeciesRegistry::getInstance().getDefault()),
+      careRoutine(nullptr), context(nullptr),
+      currentState(nullptr), careStrategy(nullptr) {
+    slot = store->allocate(this);
+}
 
 Plant::Plant(int id, const std::string& spec) 
     : Plant() {
-    plantId = id;
-    species = spec;
+    store->plantId[slot] = id;
+    setSpecies(spec);
 }
 
 Plant::Plant(const std::string& spec, int daysToMat) 
     : Plant() {
-    species = spec;
-    daysToMaturity = daysToMat;
+    setSpecies(spec);
+    store->daysToMaturity[slot] = daysToMat;
+}
+
+Plant::Plant(const SpeciesTraits* speciesTraits)
+    : Plant() {
+    if (speciesTraits) {
+        traits = speciesTraits;
+    }
+    // An adopted slot already holds this plant's restored values
+    if (!store->takeAdoptedAllocation()) {
+        applySpeciesDefaults();
+    }
 }
 
 Plant::~Plant() {
     // Note: Don't delete careRoutine, context, state, strategy
     // They may be shared or managed elsewhere
+    store->release(slot);
 }
 
 Plant::Plant(const Plant& other) 
-    : plantId(other.plantId), species(other.species),
-      scientificName(other.scientificName), age(other.age),
-      height(other.height), basePrice(other.basePrice),
-      readyForSale(other.readyForSale), healthLevel(other.healthLevel),
-      wateringFrequency(other.wateringFrequency),
-      sunlightRequirement(other.sunlightRequirement),
-      fertilizingFrequency(other.fertilizingFrequency),
-      soilType(other.soilType), daysToMaturity(other.daysToMaturity),
-      currentGrowthDays(other.currentGrowthDays),
-      currentSeason(other.currentSeason),
+    : store(other.store), slot(0), traits(other.traits),
       careRoutine(other.careRoutine), context(other.context),
       currentState(other.currentState), careStrategy(other.careStrategy),
-      location(other.location), shelfNumber(other.shelfNumber),
-      timesWatered(0), timesFertilized(0), timesPruned(0) {}
+      location(other.location) {
+    slot = store->allocate(this);
+    PlantStore& s = *store;
+    const size_t from = other.slot;
+    s.plantId[slot] = s.plantId[from];
+    s.age[slot] = s.age[from];
+    s.height[slot] = s.height[from];
+    s.basePrice[slot] = s.basePrice[from];
+    s.readyForSale[slot] = s.readyForSale[from];
+    s.healthLevel[slot] = s.healthLevel[from];
+    s.wateringFrequency[slot] = s.wateringFrequency[from];
+    s.sunlightRequirement[slot] = s.sunlightRequirement[from];
+    s.fertilizingFrequency[slot] = s.fertilizingFrequency[from];
+    s.daysToMaturity[slot] = s.daysToMaturity[from];
+    s.currentGrowthDays[slot] = s.currentGrowthDays[from];
+    s.shelfNumber[slot] = s.shelfNumber[from];
+    // Care history starts fresh for a propagated plant (counters stay 0)
+    s.careChangedAll(slot);
+}
+
+Plant& Plant::operator=(const Plant& other) {
+    if (this == &other) {
+        return *this;
+    }
+    traits = other.traits;
+    careRoutine = other.careRoutine;
+    context = other.context;
+    currentState = other.currentState;
+    careStrategy = other.careStrategy;
+    location = other.location;
+
+    // Keep our own slot; copy the column values across (stores may differ)
+    PlantStore& to = *store;
+    const PlantStore& from = *other.store;
+    const size_t src = other.slot;
+    to.plantId[slot] = from.plantId[src];
+    to.age[slot] = from.age[src];
+    to.height[slot] = from.height[src];
+    to.basePrice[slot] = from.basePrice[src];
+    to.readyForSale[slot] = from.readyForSale[src];
+    to.healthLevel[slot] = from.healthLevel[src];
+    to.wateringFrequency[slot] = from.wateringFrequency[src];
+    to.sunlightRequirement[slot] = from.sunlightRequirement[src];
+    to.fertilizingFrequency[slot] = from.fertilizingFrequency[src];
+    to.daysToMaturity[slot] = from.daysToMaturity[src];
+    to.currentGrowthDays[slot] = from.currentGrowthDays[src];
+    to.timesWatered[slot] = from.timesWatered[src];
+    to.timesFertilized[slot] = from.timesFertilized[src];
+    to.timesPruned[slot] = from.timesPruned[src];
+    to.shelfNumber[slot] = from.shelfNumber[src];
+    to.lastWatered[slot] = from.lastWatered[src];
+    to.lastFertilized[slot] = from.lastFertilized[src];
+    to.lastPruned[slot] = from.lastPruned[src];
+    to.careChangedAll(slot);
+    return *this;
+}
 
 // ========== IDENTITY METHODS ==========
 
-int Plant::getPlantId() const { return plantId; }
-void Plant::setPlantId(int id) { plantId = id; }
+int Plant::getPlantId() const { return store->plantId[slot]; }
+void Plant::setPlantId(int id) {
+    store->plantId[slot] = id;
+    store->valuesChanged(slot);
+}
 
-std::string Plant::getSpecies() const { return species; }
-void Plant::setSpecies(const std::string& spec) { species = spec; }
+const std::string& Plant::getSpecies() const { return traits->getSpecies(); }
+void Plant::setSpecies(const std::string& spec) {
+    if (spec != traits->getSpecies()) {
+        traits = SpeciesRegistry::getInstance().intern(traits->withSpecies(spec));
+        store->valuesChanged(slot);
+    }
+}
+
+const std::string& Plant::getScientificName() const { return traits->getScientificName(); }
+void Plant::setScientificName(const std::string& name) {
+    if (name != traits->getScientificName()) {
+        traits = SpeciesRegistry::getInstance().intern(traits->withScientificName(name));
+    }
+}
 
-std::string Plant::getScientificName() const { return scientificName; }
-void Plant::setScientificName(const std::string& name) { scientificName = name; }
+const SpeciesTraits* Plant::getTraits() const { return traits; }
 
-int Plant::getAge() const { return age; }
-void Plant::incrementAge() { age++; }
+int Plant::getAge() const { return store->age[slot]; }
+void Plant::incrementAge() {
+    store->age[slot]++;
+    store->careChanged(slot, CareTask::Water);
+    store->careChanged(slot, CareTask::Fertilize);
+}
 
 // ========== PHYSICAL METHODS ==========
 
-double Plant::getHeight() const { return height; }
-void Plant::setHeight(double h) { height = h; }
-void Plant::grow(double amount) { height += amount; }
+double Plant::getHeight() const { return store->height[slot]; }
+void Plant::setHeight(double h) {
+    store->height[slot] = h;
+    store->careChanged(slot, CareTask::Prune);
+}
+void Plant::grow(double amount) {
+    store->height[slot] += amount;
+    store->careChanged(slot, CareTask::Prune);
+}
 
-double Plant::getBasePrice() const { return basePrice; }
-void Plant::setBasePrice(double price) { basePrice = price; }
+double Plant::getBasePrice() const { return store->basePrice[slot]; }
+void Plant::setBasePrice(double price) {
+    store->basePrice[slot] = price;
+    store->valuesChanged(slot);
+}
 
-bool Plant::isReadyForSale() const { return readyForSale; }
-void Plant::setReadyForSale(bool ready) { readyForSale = ready; }
+bool Plant::isReadyForSale() const { return store->readyForSale[slot] != 0; }
+void Plant::setReadyForSale(bool ready) {
+    store->readyForSale[slot] = ready ? 1 : 0;
+    store->valuesChanged(slot);
+}
 
-int Plant::getHealthLevel() const { return healthLevel; }
+int Plant::getHealthLevel() const { return store->healthLevel[slot]; }
 void Plant::setHealthLevel(int health) { 
-    healthLevel = health;
-    if (healthLevel > 100) healthLevel = 100;
-    if (healthLevel < 0) healthLevel = 0;
+    if (health > 100) health = 100;
+    if (health < 0) health = 0;
+    store->healthLevel[slot] = health;
+    store->valuesChanged(slot);
 }
 void Plant::modifyHealth(int delta) { 
-    setHealthLevel(healthLevel + delta); 
+    setHealthLevel(store->healthLevel[slot] + delta); 
 }
 
 // ========== CARE REQUIREMENTS ==========
 
-int Plant::getWateringFrequency() const { return wateringFrequency; }
-void Plant::setWateringFrequency(int days) { wateringFrequency = days; }
+int Plant::getWateringFrequency() const { return store->wateringFrequency[slot]; }
+void Plant::setWateringFrequency(int days) {
+    store->wateringFrequency[slot] = days;
+    store->careChanged(slot, CareTask::Water);
+}
 
-int Plant::getSunlightRequirement() const { return sunlightRequirement; }
-void Plant::setSunlightRequirement(int hours) { sunlightRequirement = hours; }
+int Plant::getSunlightRequirement() const { return store->sunlightRequirement[slot]; }
+void Plant::setSunlightRequirement(int hours) { store->sunlightRequirement[slot] = hours; }
 
-int Plant::getFertilizingFrequency() const { return fertilizingFrequency; }
-void Plant::setFertilizingFrequency(int days) { fertilizingFrequency = days; }
+int Plant::getFertilizingFrequency() const { return store->fertilizingFrequency[slot]; }
+void Plant::setFertilizingFrequency(int days) {
+    store->fertilizingFrequency[slot] = days;
+    store->careChanged(slot, CareTask::Fertilize);
+}
 
-std::string Plant::getSoilType() const { return soilType; }
-void Plant::setSoilType(const std::string& soil) { soilType = soil; }
+const std::string& Plant::getSoilType() const { return traits->getSoilType(); }
+void Plant::setSoilType(const std::string& soil) {
+    if (soil != traits->getSoilType()) {
+        traits = SpeciesRegistry::getInstance().intern(traits->withSoilType(soil));
+    }
+}
 
 // ========== LIFECYCLE METHODS ==========
 
-int Plant::getDaysToMaturity() const { return daysToMaturity; }
-void Plant::setDaysToMaturity(int days) { daysToMaturity = days; }
+int Plant::getDaysToMaturity() const { return store->daysToMaturity[slot]; }
+void Plant::setDaysToMaturity(int days) {
+    store->daysToMaturity[slot] = days;
+    store->valuesChanged(slot);
+}
 
-int Plant::getCurrentGrowthDays() const { return currentGrowthDays; }
+int Plant::getCurrentGrowthDays() const { return store->currentGrowthDays[slot]; }
 void Plant::incrementGrowthDays() { 
-    currentGrowthDays++; 
-    if (currentGrowthDays >= daysToMaturity && !readyForSale) {
-        readyForSale = true;
-        std::cout << species << " #" << plantId << " is now mature and ready for sale!" << std::endl;
+    int growth = ++store->currentGrowthDays[slot];
+    if (growth >= store->daysToMaturity[slot] && !store->readyForSale[slot]) {
+        store->readyForSale[slot] = 1;
+        LOG_INFO(getSpecies() << " #" << getPlantId() << " is now mature and ready for sale!");
     }
+    store->valuesChanged(slot);
 }
 
-std::string Plant::getCurrentSeason() const { return currentSeason; }
-void Plant::setCurrentSeason(const std::string& season) { currentSeason = season; }
+const std::string& Plant::getCurrentSeason() const { return traits->getSeason(); }
+void Plant::setCurrentSeason(const std::string& season) {
+    if (season != traits->getSeason()) {
+        traits = SpeciesRegistry::getInstance().intern(traits->withSeason(season));
+    }
+}
 
-bool Plant::isMature() const { return currentGrowthDays >= daysToMaturity; }
+bool Plant::isMature() const { return store->currentGrowthDays[slot] >= store->daysToMaturity[slot]; }
 
 // ========== PATTERN RELATIONSHIPS ==========
 
@@ -156,30 +269,30 @@ void Plant::applyCareStrategy() {
 // ========== CARE ACTIONS ==========
 
 void Plant::water() {
-    timesWatered++;
+    store->timesWatered[slot]++;
+    store->careChanged(slot, CareTask::Water);
     modifyHealth(5);
-    time_t now = time(0);
-    lastWatered = ctime(&now);
-    std::cout << species << " #" << plantId << " was watered. Health: " 
-              << healthLevel << "%" << std::endl;
+    store->lastWatered[slot] = SimulationClock::getInstance().now();
+    LOG_INFO(getSpecies() << " #" << getPlantId() << " was watered. Health: " 
+             << getHealthLevel() << "%");
 }
 
 void Plant::fertilize() {
-    timesFertilized++;
+    store->timesFertilized[slot]++;
+    store->careChanged(slot, CareTask::Fertilize);
     modifyHealth(10);
     grow(2.0);
-    time_t now = time(0);
-    lastFertilized = ctime(&now);
-    std::cout << species << " #" << plantId << " was fertilized. Health: " 
-              << healthLevel << "%, Height: " << height << "cm" << std::endl;
+    store->lastFertilized[slot] = SimulationClock::getInstance().now();
+    LOG_INFO(getSpecies() << " #" << getPlantId() << " was fertilized. Health: " 
+             << getHealthLevel() << "%, Height: " << getHeight() << "cm");
 }
 
 void Plant::prune() {
-    timesPruned++;
+    store->timesPruned[slot]++;
+    store->careChanged(slot, CareTask::Prune);
     modifyHealth(3);
-    time_t now = time(0);
-    lastPruned = ctime(&now);
-    std::cout << species << " #" << plantId << " was pruned." << std::endl;
+    store->lastPruned[slot] = SimulationClock::getInstance().now();
+    LOG_INFO(getSpecies() << " #" << getPlantId() << " was pruned.");
 }
 
 void Plant::inspect() {
@@ -189,39 +302,62 @@ void Plant::inspect() {
 
 // ========== HISTORY TRACKING ==========
 
-std::string Plant::getLastWatered() const { return lastWatered; }
-void Plant::updateLastWatered(const std::string& timestamp) { lastWatered = timestamp; }
+std::string Plant::getLastWatered() const {
+    return SimulationClock::getInstance().format(store->lastWatered[slot]);
+}
+int64_t Plant::getLastWateredTime() const { return store->lastWatered[slot]; }
+void Plant::updateLastWatered(int64_t timestamp) { store->lastWatered[slot] = timestamp; }
 
-std::string Plant::getLastFertilized() const { return lastFertilized; }
-void Plant::updateLastFertilized(const std::string& timestamp) { lastFertilized = timestamp; }
+std::string Plant::getLastFertilized() const {
+    return SimulationClock::getInstance().format(store->lastFertilized[slot]);
+}
+int64_t Plant::getLastFertilizedTime() const { return store->lastFertilized[slot]; }
+void Plant::updateLastFertilized(int64_t timestamp) { store->lastFertilized[slot] = timestamp; }
 
-std::string Plant::getLastPruned() const { return lastPruned; }
-void Plant::updateLastPruned(const std::string& timestamp) { lastPruned = timestamp; }
+std::string Plant::getLastPruned() const {
+    return SimulationClock::getInstance().format(store->lastPruned[slot]);
+}
+int64_t Plant::getLastPrunedTime() const { return store->lastPruned[slot]; }
+void Plant::updateLastPruned(int64_t timestamp) { store->lastPruned[slot] = timestamp; }
 
-int Plant::getTimesWatered() const { return timesWatered; }
-int Plant::getTimesFertilized() const { return timesFertilized; }
-int Plant::getTimesPruned() const { return timesPruned; }
+int Plant::getTimesWatered() const { return store->timesWatered[slot]; }
+int Plant::getTimesFertilized() const { return store->timesFertilized[slot]; }
+int Plant::getTimesPruned() const { return store->timesPruned[slot]; }
 
 // ========== LOCATION METHODS ==========
 
 std::string Plant::getLocation() const { return location; }
 void Plant::setLocation(const std::string& loc) { location = loc; }
 
-int Plant::getShelfNumber() const { return shelfNumber; }
-void Plant::setShelfNumber(int shelf) { shelfNumber = shelf; }
+int Plant::getShelfNumber() const { return store->shelfNumber[slot]; }
+void Plant::setShelfNumber(int shelf) { store->shelfNumber[slot] = shelf; }
+
+PlantLeaf* Plant::getLeaf() const {
+    return PlantLeafIndex::leafOf(this);
+}
+
+Shelf* Plant::getShelf() const {
+    PlantLeaf* leaf = getLeaf();
+    return leaf ? dynamic_cast<Shelf*>(leaf->getParent()) : nullptr;
+}
+
+// ========== COLUMNAR STORAGE ==========
+
+PlantStore* Plant::getStore() const { return store; }
+size_t Plant::getSlot() const { return slot; }
 
 // ========== DISPLAY & INFO ==========
 
 void Plant::display() const {
-    std::cout << "Plant ID: " << plantId << std::endl;
-    std::cout << "Species: " << species << std::endl;
+    std::cout << "Plant ID: " << getPlantId() << std::endl;
+    std::cout << "Species: " << getSpecies() << std::endl;
     std::cout << "Type: " << getType() << std::endl;
-    std::cout << "Age: " << age << " days" << std::endl;
-    std::cout << "Height: " << height << " cm" << std::endl;
-    std::cout << "Health: " << healthLevel << "%" << std::endl;
-    std::cout << "Growth: " << currentGrowthDays << "/" << daysToMaturity << " days" << std::endl;
-    std::cout << "Ready for Sale: " << (readyForSale ? "Yes" : "No") << std::endl;
-    std::cout << "Price: R" << std::fixed << std::setprecision(2) << basePrice << std::endl;
+    std::cout << "Age: " << getAge() << " days" << std::endl;
+    std::cout << "Height: " << getHeight() << " cm" << std::endl;
+    std::cout << "Health: " << getHealthLevel() << "%" << std::endl;
+    std::cout << "Growth: " << getCurrentGrowthDays() << "/" << getDaysToMaturity() << " days" << std::endl;
+    std::cout << "Ready for Sale: " << (isReadyForSale() ? "Yes" : "No") << std::endl;
+    std::cout << "Price: R" << std::fixed << std::setprecision(2) << getBasePrice() << std::endl;
     std::cout << "Location: " << location << std::endl;
 }
 
@@ -235,8 +371,8 @@ std::string Plant::getStateDescription() const {
 
 std::string Plant::getCareDescription() const {
     std::ostringstream oss;
-    oss << "Water every " << wateringFrequency << " days, "
-        << "Fertilize every " << fertilizingFrequency << " days";
+    oss << "Water every " << getWateringFrequency() << " days, "
+        << "Fertilize every " << getFertilizingFrequency() << " days";
     return oss.str();
 }
 
@@ -244,19 +380,19 @@ std::string Plant::getCareDescription() const {
 
 bool Plant::needsWater() const {
     // Simple check - in real system compare timestamp
-    return timesWatered < (age / wateringFrequency);
+    return store->timesWatered[slot] < (store->age[slot] / store->wateringFrequency[slot]);
 }
 
 bool Plant::needsFertilizer() const {
-    return timesFertilized < (age / fertilizingFrequency);
+    return store->timesFertilized[slot] < (store->age[slot] / store->fertilizingFrequency[slot]);
 }
 
 bool Plant::needsPruning() const {
-    return height > 50.0 && timesPruned < 3;
+    return store->height[slot] > 50.0 && store->timesPruned[slot] < 3;
 }
 
 bool Plant::isHealthy() const {
-    return healthLevel > 70;
+    return store->healthLevel[slot] > 70;
 }
 
 bool Plant::needsAttention() const {
@@ -281,16 +417,22 @@ void Plant::initialize() {
     // Override in derived classes for specific initialization
 }
 
+void Plant::applySpeciesDefaults() {
+    setHeight(traits->getInitialHeight());
+    setBasePrice(traits->getBasePrice());
+    setWateringFrequency(traits->getWateringFrequency());
+    setSunlightRequirement(traits->getSunlightRequirement());
+    setFertilizingFrequency(traits->getFertilizingFrequency());
+    setDaysToMaturity(traits->getDaysToMaturity());
+    setHealthLevel(100);
+}
+
 // ========== SERIALIZATION ==========
 
 std::string Plant::serialize() const {
-    std::ostringstream oss;
-    oss << plantId << "," << species << "," << age << "," 
-        << height << "," << healthLevel << "," << readyForSale;
-    return oss.str();
+    return PlantSnapshot::encodePlant(*this);
 }
 
-void Plant::deserialize(const std::string& data) {
-    // Parse CSV string and restore plant state
-    // Implementation depends on your needs
-}
\ No newline at end of file
+bool Plant::deserialize(const std::string& data) {
+    return PlantSnapshot::decodePlant(*this, data);
+}
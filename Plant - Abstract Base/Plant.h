@@ -1,39 +1,33 @@
 #ifndef PLANT_H
 #define PLANT_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
 // Forward declarations
+class PlantStore;
+class SpeciesTraits;
 class PlantCareRoutine;
 class PlantContext;
 class PlantCareStrategy;
 class PlantState;
+class PlantLeaf;
+class Shelf;
 
 class Plant {
 private:
-    // ========== IDENTITY ATTRIBUTES ==========
-    int plantId;                          // Unique identifier
-    std::string species;                  // "Rose", "Cactus", "Lavender", etc.
-    std::string scientificName;           // e.g., "Rosa rubiginosa"
-    int age;                              // Age in days
-
-    // ========== PHYSICAL ATTRIBUTES ==========
-    double height;                        // Height in cm
-    double basePrice;                     // Base selling price
-    bool readyForSale;                    // Is it mature enough to sell?
-    int healthLevel;                      // 0-100 health percentage
-
-    // ========== CARE REQUIREMENTS ==========
-    int wateringFrequency;                // Days between watering
-    int sunlightRequirement;              // Hours per day (1-12)
-    int fertilizingFrequency;             // Days between fertilizing
-    std::string soilType;                 // "sandy", "loamy", "clay", etc.
-
-    // ========== LIFECYCLE TRACKING ==========
-    int daysToMaturity;                   // Days until ready for sale
-    int currentGrowthDays;                // Days since planting
-    std::string currentSeason;            // "spring", "summer", "fall", "winter"
+    // ========== COLUMNAR STORAGE ==========
+    // Numeric attributes (age, height, price, health, care frequencies,
+    // growth tracking, care counters and timestamps, shelf) live in a PlantStore slot.
+    PlantStore* store;                    // Store holding this plant's columns
+    size_t slot;                          // Slot index within the store
+
+    // ========== SHARED SPECIES DATA (Flyweight) ==========
+    // Species, scientific name, soil type and season are shared by every plant
+    // of a kind; setters intern an override variant instead of copying strings.
+    const SpeciesTraits* traits;
 
     // ========== PATTERN RELATIONSHIPS ==========
     // Template Pattern - care routine
@@ -46,21 +40,19 @@ private:
     // Strategy Pattern - watering strategy
     PlantCareStrategy* careStrategy;      // Current care strategy
 
-    // ========== HISTORY & METADATA ==========
-    std::string lastWatered;              // Timestamp of last watering
-    std::string lastFertilized;           // Timestamp of last fertilizing
-    std::string lastPruned;               // Timestamp of last pruning
-    int timesWatered;                     // Total watering count
-    int timesFertilized;                  // Total fertilizing count
-    int timesPruned;                      // Total pruning count
-
     // ========== COMPOSITE/INVENTORY ==========
     std::string location;                 // "Greenhouse Section A", "Shelf 3", etc.
-    int shelfNumber;                      // Which shelf it's on
 
 protected:
-    // Protected constructor for derived classes
+    // Protected constructors for derived classes
     Plant(const std::string& species, int daysToMaturity);
+    explicit Plant(const SpeciesTraits* speciesTraits);  // Slot initialised from the traits
+
+    // Reset the care defaults in this plant's slot from its traits
+    void applySpeciesDefaults();
+
+    friend class PlantSnapshot;  // Binary persistence reads and restores every field
+    friend class MappedSnapshot; // Binds handles to slots restored from a mapped image
 
 public:
     // ========== CONSTRUCTORS & DESTRUCTOR ==========
@@ -70,6 +62,7 @@ public:
 
     // Copy constructor for Prototype pattern
     Plant(const Plant& other);
+    Plant& operator=(const Plant& other);
 
     // Virtual clone for Prototype pattern
     virtual Plant* clone() const = 0;
@@ -78,12 +71,14 @@ public:
     int getPlantId() const;
     void setPlantId(int id);
 
-    std::string getSpecies() const;
+    const std::string& getSpecies() const;
     void setSpecies(const std::string& species);
 
-    std::string getScientificName() const;
+    const std::string& getScientificName() const;
     void setScientificName(const std::string& name);
 
+    const SpeciesTraits* getTraits() const;
+
     int getAge() const;
     void incrementAge();  // Called daily/per time step
 
@@ -112,7 +107,7 @@ public:
     int getFertilizingFrequency() const;
     void setFertilizingFrequency(int days);
 
-    std::string getSoilType() const;
+    const std::string& getSoilType() const;
     void setSoilType(const std::string& soil);
 
     // ========== LIFECYCLE GETTERS/SETTERS ==========
@@ -122,7 +117,7 @@ public:
     int getCurrentGrowthDays() const;
     void incrementGrowthDays();
 
-    std::string getCurrentSeason() const;
+    const std::string& getCurrentSeason() const;
     void setCurrentSeason(const std::string& season);
 
     bool isMature() const;  // currentGrowthDays >= daysToMaturity
@@ -154,14 +149,19 @@ public:
     void inspect();
 
     // ========== HISTORY TRACKING ==========
+    // Timestamps come from SimulationClock; the string getters format them
+    // for display ("" if the action has never happened)
     std::string getLastWatered() const;
-    void updateLastWatered(const std::string& timestamp);
+    int64_t getLastWateredTime() const;
+    void updateLastWatered(int64_t timestamp);
 
     std::string getLastFertilized() const;
-    void updateLastFertilized(const std::string& timestamp);
+    int64_t getLastFertilizedTime() const;
+    void updateLastFertilized(int64_t timestamp);
 
     std::string getLastPruned() const;
-    void updateLastPruned(const std::string& timestamp);
+    int64_t getLastPrunedTime() const;
+    void updateLastPruned(int64_t timestamp);
 
     int getTimesWatered() const;
     int getTimesFertilized() const;
@@ -174,6 +174,20 @@ public:
     int getShelfNumber() const;
     void setShelfNumber(int shelf);
 
+    /**
+     * @brief Leaf showing this plant in a greenhouse layout, or nullptr (no tree search)
+     */
+    PlantLeaf* getLeaf() const;
+
+    /**
+     * @brief Shelf holding getLeaf(), or nullptr
+     */
+    Shelf* getShelf() const;
+
+    // ========== COLUMNAR STORAGE ==========
+    PlantStore* getStore() const;
+    size_t getSlot() const;
+
     // ========== DISPLAY & INFO ==========
     virtual void display() const;  // Virtual for polymorphism
     virtual std::string getType() const = 0;  // Pure virtual - each plant type implements
@@ -192,8 +206,8 @@ public:
     virtual void initialize();  // Initialize plant-specific values
 
     // ========== SERIALIZATION (Optional for save/load) ==========
-    std::string serialize() const;  // Convert to string for saving
-    void deserialize(const std::string& data);  // Load from string
+    std::string serialize() const;  // Binary record covering every field (see PlantSnapshot)
+    bool deserialize(const std::string& data);  // Restore from serialize() output
 };
 
 #endif // PLANT_H
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include "PlantAttentionKernel.h"
+#include "PlantUpdateKernel.h"
+#include "AttentionBitmaps.h"
+#include <cstdint>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+#define ATTENTION_KERNEL_AVX2 1
+#include <immintrin.h>
+#else
+#define ATTENTION_KERNEL_AVX2 0
+#endif
+
+namespace {
+
+const int PRUNE_LIMIT = 3;
+const double PRUNE_HEIGHT = 50.0;
+const int HEALTHY_ABOVE = 70;
+
+struct Words {
+    uint64_t water;
+    uint64_t fertilizer;
+    uint64_t pruning;
+    uint64_t unhealthy;
+};
+
+inline bool careDue(int done, int age, int every) {
+    return every != 0 && done < age / every;
+}
+
+// ========== SCALAR PATH (also used for tails) ==========
+
+Words evaluateScalar(const PlantAttentionKernel::Columns& c, size_t base, size_t rows) {
+    Words w = {0, 0, 0, 0};
+    for (size_t j = 0; j < rows; j++) {
+        const size_t i = base + j;
+        w.water |= uint64_t(careDue(c.timesWatered[i], c.age[i], c.wateringFrequency[i])) << j;
+        w.fertilizer |= uint64_t(careDue(c.timesFertilized[i], c.age[i], c.fertilizingFrequency[i])) << j;
+        w.pruning |= uint64_t(c.height[i] > PRUNE_HEIGHT && c.timesPruned[i] < PRUNE_LIMIT) << j;
+        w.unhealthy |= uint64_t(c.healthLevel[i] <= HEALTHY_ABOVE) << j;
+    }
+    return w;
+}
+
+#if ATTENTION_KERNEL_AVX2
+
+// ========== AVX2 PATH (8 rows per instruction) ==========
+
+__attribute__((target("avx2")))
+inline uint64_t careDueBits(__m256i done, __m256i age, __m256i every) {
+    // int32 / int32 is exact through double; x / 0 becomes +-inf or NaN, which
+    // converts to INT_MIN and never exceeds 'done'
+    __m256d lo = _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(age)),
+                               _mm256_cvtepi32_pd(_mm256_castsi256_si128(every)));
+    __m256d hi = _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(age, 1)),
+                               _mm256_cvtepi32_pd(_mm256_extracti128_si256(every, 1)));
+    __m256i quotient = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(lo)),
+                                               _mm256_cvttpd_epi32(hi), 1);
+    __m256i nonZero = _mm256_xor_si256(_mm256_cmpeq_epi32(every, _mm256_setzero_si256()),
+                                       _mm256_set1_epi32(-1));
+    __m256i due = _mm256_and_si256(_mm256_cmpgt_epi32(quotient, done), nonZero);
+    return static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(due)));
+}
+
+__attribute__((target("avx2")))
+Words evaluateAVX2(const PlantAttentionKernel::Columns& c, size_t base) {
+    const __m256i pruneLimit = _mm256_set1_epi32(PRUNE_LIMIT);
+    const __m256i healthyAbove = _mm256_set1_epi32(HEALTHY_ABOVE);
+    const __m256d pruneHeight = _mm256_set1_pd(PRUNE_HEIGHT);
+
+    Words w = {0, 0, 0, 0};
+    for (size_t j = 0; j < 64; j += 8) {
+        const size_t i = base + j;
+        const __m256i age = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.age + i));
+        const __m256i health = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.healthLevel + i));
+        const __m256i waterEvery = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.wateringFrequency + i));
+        const __m256i fertilizeEvery = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.fertilizingFrequency + i));
+        const __m256i watered = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.timesWatered + i));
+        const __m256i fertilized = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.timesFertilized + i));
+        const __m256i pruned = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.timesPruned + i));
+
+        w.water |= careDueBits(watered, age, waterEvery) << j;
+        w.fertilizer |= careDueBits(fertilized, age, fertilizeEvery) << j;
+
+        uint64_t tall = static_cast<uint64_t>(
+            _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(c.height + i), pruneHeight, _CMP_GT_OQ)) |
+            (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(c.height + i + 4), pruneHeight, _CMP_GT_OQ)) << 4));
+        uint64_t underLimit = static_cast<uint64_t>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pruneLimit, pruned))));
+        w.pruning |= (tall & underLimit) << j;
+
+        uint64_t healthy = static_cast<uint64_t>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(health, healthyAbove))));
+        w.unhealthy |= (~healthy & 0xFF) << j;
+    }
+    return w;
+}
+
+#endif // ATTENTION_KERNEL_AVX2
+
+uint64_t liveBits(const PlantAttentionKernel::Columns& c, size_t base, size_t rows) {
+    uint64_t live = 0;
+    for (size_t j = 0; j < rows; j++) {
+        live |= uint64_t(c.owner[base + j] != nullptr) << j;
+    }
+    return live;
+}
+
+} // namespace
+
+// ========== DISPATCH ==========
+
+void PlantAttentionKernel::run(const Columns& cols, size_t count, AttentionBitmaps& out) {
+    auto words = [&](AttentionReason reason) {
+        PositionBitmap& bitmap = out.get(reason);
+        bitmap.assignZeros(count);
+        return bitmap.data();
+    };
+    uint64_t* water = words(AttentionReason::Water);
+    uint64_t* fertilizer = words(AttentionReason::Fertilizer);
+    uint64_t* pruning = words(AttentionReason::Pruning);
+    uint64_t* unhealthy = words(AttentionReason::Unhealthy);
+
+#if ATTENTION_KERNEL_AVX2
+    const bool wide = PlantUpdateKernel::activeLevel() == PlantUpdateKernel::Level::AVX2;
+#endif
+
+    for (size_t base = 0, word = 0; base < count; base += 64, word++) {
+        const size_t rows = count - base < 64 ? count - base : 64;
+#if ATTENTION_KERNEL_AVX2
+        const Words w = wide && rows == 64 ? evaluateAVX2(cols, base) : evaluateScalar(cols, base, rows);
+#else
+        const Words w = evaluateScalar(cols, base, rows);
+#endif
+        const uint64_t live = liveBits(cols, base, rows);
+        water[word] = w.water & live;
+        fertilizer[word] = w.fertilizer & live;
+        pruning[word] = w.pruning & live;
+        unhealthy[word] = w.unhealthy & live;
+    }
+}
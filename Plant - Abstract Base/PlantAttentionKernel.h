@@ -0,0 +1,49 @@
+#ifndef PLANTATTENTIONKERNEL_H
+#define PLANTATTENTIONKERNEL_H
+
+#include <cstddef>
+
+class AttentionBitmaps;
+class Plant;
+
+/**
+ * @brief Bulk evaluation of the Plant::needsAttention() checks over store columns
+ *
+ * Per row:
+ *   Water       timesWatered < age / wateringFrequency
+ *   Fertilizer  timesFertilized < age / fertilizingFrequency
+ *   Pruning     height > 50 and timesPruned < 3
+ *   Unhealthy   healthLevel <= 70
+ *
+ * Each check produces one bit per row, packed 64 rows to a bitmap word. On
+ * AVX2 CPUs 8 rows are compared per instruction and the lane masks are
+ * gathered with movemask; other targets use a branch-free scalar loop.
+ * Rows without an owner are never set. A frequency of 0 never flags a row.
+ */
+class PlantAttentionKernel {
+public:
+    /**
+     * @brief Column pointers the kernel reads (all of equal length)
+     */
+    struct Columns {
+        const int* age;
+        const int* healthLevel;
+        const double* height;
+        const int* wateringFrequency;
+        const int* fertilizingFrequency;
+        const int* timesWatered;
+        const int* timesFertilized;
+        const int* timesPruned;
+        Plant* const* owner;
+    };
+
+    /**
+     * @brief Evaluate every row into the four reason bitmaps (previous contents are replaced)
+     * @param cols Column pointers
+     * @param count Number of rows
+     * @param out Receives one bit per row and reason
+     */
+    static void run(const Columns& cols, size_t count, AttentionBitmaps& out);
+};
+
+#endif // PLANTATTENTIONKERNEL_H
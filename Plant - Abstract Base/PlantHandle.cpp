@@ -0,0 +1,38 @@
+#include "PlantHandle.h"
+#include "Plant.h"
+#include "PlantStore.h"
+
+PlantHandle::PlantHandle() : store(nullptr), slot(0), generation(0) {
+}
+
+PlantHandle::PlantHandle(const Plant* plant) : store(nullptr), slot(0), generation(0) {
+    if (plant) {
+        store = plant->getStore();
+        slot = static_cast<uint32_t>(plant->getSlot());
+        generation = store->getGeneration(slot);
+    }
+}
+
+Plant* PlantHandle::get() const {
+    return store ? store->resolve(slot, generation) : nullptr;
+}
+
+bool PlantHandle::isNull() const {
+    return store == nullptr;
+}
+
+bool PlantHandle::isStale() const {
+    return store != nullptr && get() == nullptr;
+}
+
+PlantHandle::operator bool() const {
+    return get() != nullptr;
+}
+
+bool PlantHandle::operator==(const PlantHandle& other) const {
+    return store == other.store && slot == other.slot && generation == other.generation;
+}
+
+bool PlantHandle::operator!=(const PlantHandle& other) const {
+    return !(*this == other);
+}
@@ -0,0 +1,57 @@
+#ifndef PLANTHANDLE_H
+#define PLANTHANDLE_H
+
+#include <cstddef>
+#include <cstdint>
+
+class Plant;
+class PlantStore;
+
+/**
+ * @brief Non-owning, generation-checked reference to a plant
+ *
+ * A handle names a PlantStore slot together with the generation the slot had
+ * when the handle was taken. Every release of a slot bumps its generation, so
+ * once the plant is destroyed get() returns nullptr - even after the slot has
+ * been reused by another plant - instead of a dangling pointer. Lookup is two
+ * array reads.
+ *
+ * Holders that merely refer to plants (composite leaves, arrangements, plant
+ * products) keep handles; whoever owns a plant keeps the Plant*.
+ */
+class PlantHandle {
+private:
+    PlantStore* store;
+    uint32_t slot;
+    uint32_t generation;
+
+public:
+    /**
+     * @brief Null handle
+     */
+    PlantHandle();
+
+    /**
+     * @brief Handle to a live plant (null handle for nullptr)
+     */
+    explicit PlantHandle(const Plant* plant);
+
+    /**
+     * @brief The plant, or nullptr if the handle is null or the plant was destroyed
+     */
+    Plant* get() const;
+
+    bool isNull() const;
+
+    /**
+     * @brief Whether the handle referred to a plant that no longer exists
+     */
+    bool isStale() const;
+
+    explicit operator bool() const;
+
+    bool operator==(const PlantHandle& other) const;
+    bool operator!=(const PlantHandle& other) const;
+};
+
+#endif // PLANTHANDLE_H
@@ -0,0 +1,364 @@
+#include "PlantStore.h"
+#include "Plant.h"
+#include "PlantUpdateKernel.h"
+#include "PlantAttentionKernel.h"
+#include "AttentionBitmaps.h"
+#include "PlantStoreObserver.h"
+#include "../Flyweight - Species Traits/SpeciesTraits.h"
+#include "../Command - Staff Functions/CareTimerWheel.h"
+#include "../Composite - The Store layout/PlantLeafIndex.h"
+#include "../Core - Simulation Services/SimulationClock.h"
+#include "../Core - Simulation Services/Logger.h"
+#include <algorithm>
+
+PlantStore::PlantStore()
+    : liveCount(0), daysTicked(0), careSchedule(nullptr),
+      mappedBase(nullptr), mappedLength(0), mappedRelease(nullptr),
+      adoptSlot(NO_SLOT), lastAllocationAdopted(false) {
+}
+
+PlantStore::~PlantStore() {
+    // Handles are owned elsewhere - just detach the columns
+    leafIndex.reset();
+    owner.clear();
+    freeSlots.clear();
+    releaseMapping();
+}
+
+PlantStore& PlantStore::getInstance() {
+    static PlantStore instance;
+    return instance;
+}
+
+// ========== SLOT MANAGEMENT ==========
+
+size_t PlantStore::allocate(Plant* plant) {
+    if (adoptSlot != NO_SLOT) {
+        // Values are already in place - bind the handle without resetting them
+        size_t slot = adoptSlot;
+        adoptSlot = NO_SLOT;
+        owner[slot] = plant;
+        liveCount++;
+        lastAllocationAdopted = true;
+        careChangedAll(slot);
+        return slot;
+    }
+    lastAllocationAdopted = false;
+
+    size_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = owner.size();
+        age.push_back(0);
+        currentGrowthDays.push_back(0);
+        daysToMaturity.push_back(0);
+        healthLevel.push_back(0);
+        height.push_back(0.0);
+        wateringFrequency.push_back(0);
+        fertilizingFrequency.push_back(0);
+        timesWatered.push_back(0);
+        timesFertilized.push_back(0);
+        readyForSale.push_back(0);
+        plantId.push_back(0);
+        basePrice.push_back(0.0);
+        sunlightRequirement.push_back(0);
+        timesPruned.push_back(0);
+        shelfNumber.push_back(0);
+        lastWatered.push_back(SimulationClock::NEVER);
+        lastFertilized.push_back(SimulationClock::NEVER);
+        lastPruned.push_back(SimulationClock::NEVER);
+        owner.push_back(nullptr);
+        generation.push_back(0);
+    }
+
+    resetSlot(slot);
+    owner[slot] = plant;
+    liveCount++;
+    careChangedAll(slot);
+    return slot;
+}
+
+size_t PlantStore::appendSlots(size_t count, const SpeciesTraits* traits, int firstId) {
+    const size_t first = owner.size();
+    const size_t end = first + count;
+
+    // Plant() defaults (see resetSlot), then the species care defaults
+    // (see Plant::applySpeciesDefaults)
+    age.resize(end, 0);
+    currentGrowthDays.resize(end, 0);
+    daysToMaturity.resize(end, traits ? traits->getDaysToMaturity() : 60);
+    healthLevel.resize(end, 100);
+    height.resize(end, traits ? traits->getInitialHeight() : 0.0);
+    wateringFrequency.resize(end, traits ? traits->getWateringFrequency() : 7);
+    fertilizingFrequency.resize(end, traits ? traits->getFertilizingFrequency() : 30);
+    timesWatered.resize(end, 0);
+    timesFertilized.resize(end, 0);
+    readyForSale.resize(end, 0);
+    plantId.resize(end, 0);
+    basePrice.resize(end, traits ? traits->getBasePrice() : 0.0);
+    sunlightRequirement.resize(end, traits ? traits->getSunlightRequirement() : 6);
+    timesPruned.resize(end, 0);
+    shelfNumber.resize(end, 0);
+    lastWatered.resize(end, SimulationClock::NEVER);
+    lastFertilized.resize(end, SimulationClock::NEVER);
+    lastPruned.resize(end, SimulationClock::NEVER);
+    owner.resize(end, nullptr);
+    generation.resize(end, 0);
+
+    for (size_t i = 0; i < count; i++) {
+        plantId[first + i] = firstId + static_cast<int>(i);
+    }
+    return first;
+}
+
+void PlantStore::release(size_t slot) {
+    if (slot >= owner.size() || owner[slot] == nullptr) {
+        return;
+    }
+    for (PlantStoreObserver* observer : observers) {
+        observer->plantReleased(owner[slot]);
+    }
+    owner[slot] = nullptr;
+    generation[slot]++;
+    resetSlot(slot);
+    if (careSchedule) {
+        careSchedule->cancel(slot);
+    }
+    freeSlots.push_back(slot);
+    liveCount--;
+}
+
+void PlantStore::resetSlot(size_t slot) {
+    // Same defaults as Plant::Plant()
+    plantId[slot] = 0;
+    age[slot] = 0;
+    height[slot] = 0.0;
+    basePrice[slot] = 0.0;
+    readyForSale[slot] = 0;
+    healthLevel[slot] = 100;
+    wateringFrequency[slot] = 7;
+    sunlightRequirement[slot] = 6;
+    fertilizingFrequency[slot] = 30;
+    daysToMaturity[slot] = 60;
+    currentGrowthDays[slot] = 0;
+    timesWatered[slot] = 0;
+    timesFertilized[slot] = 0;
+    timesPruned[slot] = 0;
+    shelfNumber[slot] = 0;
+    lastWatered[slot] = SimulationClock::NEVER;
+    lastFertilized[slot] = SimulationClock::NEVER;
+    lastPruned[slot] = SimulationClock::NEVER;
+}
+
+void PlantStore::reserve(size_t count) {
+    age.reserve(count);
+    currentGrowthDays.reserve(count);
+    daysToMaturity.reserve(count);
+    healthLevel.reserve(count);
+    height.reserve(count);
+    wateringFrequency.reserve(count);
+    fertilizingFrequency.reserve(count);
+    timesWatered.reserve(count);
+    timesFertilized.reserve(count);
+    readyForSale.reserve(count);
+    plantId.reserve(count);
+    basePrice.reserve(count);
+    sunlightRequirement.reserve(count);
+    timesPruned.reserve(count);
+    shelfNumber.reserve(count);
+    lastWatered.reserve(count);
+    lastFertilized.reserve(count);
+    lastPruned.reserve(count);
+    owner.reserve(count);
+    generation.reserve(count);
+}
+
+size_t PlantStore::size() const {
+    return liveCount;
+}
+
+size_t PlantStore::capacity() const {
+    return owner.size();
+}
+
+Plant* PlantStore::getPlant(size_t slot) const {
+    if (slot < owner.size()) {
+        return owner[slot];
+    }
+    return nullptr;
+}
+
+uint32_t PlantStore::getGeneration(size_t slot) const {
+    if (slot < generation.size()) {
+        return generation[slot];
+    }
+    return 0;
+}
+
+Plant* PlantStore::resolve(size_t slot, uint32_t expectedGeneration) const {
+    if (slot < owner.size() && generation[slot] == expectedGeneration) {
+        return owner[slot];
+    }
+    return nullptr;
+}
+
+void PlantStore::adoptNextAllocation(size_t slot) {
+    if (slot < owner.size() && owner[slot] == nullptr) {
+        adoptSlot = slot;
+    }
+}
+
+bool PlantStore::takeAdoptedAllocation() {
+    bool adopted = lastAllocationAdopted;
+    lastAllocationAdopted = false;
+    return adopted;
+}
+
+// ========== MAPPED SNAPSHOT ==========
+
+bool PlantStore::isMapped() const {
+    return mappedBase != nullptr;
+}
+
+void PlantStore::releaseMapping() {
+    if (!mappedBase) {
+        return;
+    }
+    // Columns still pointing into the image must not outlive it
+    age.clear();
+    currentGrowthDays.clear();
+    daysToMaturity.clear();
+    healthLevel.clear();
+    height.clear();
+    wateringFrequency.clear();
+    fertilizingFrequency.clear();
+    timesWatered.clear();
+    timesFertilized.clear();
+    readyForSale.clear();
+    plantId.clear();
+    basePrice.clear();
+    sunlightRequirement.clear();
+    timesPruned.clear();
+    shelfNumber.clear();
+    lastWatered.clear();
+    lastFertilized.clear();
+    lastPruned.clear();
+    if (mappedRelease) {
+        mappedRelease(mappedBase, mappedLength);
+    }
+    mappedBase = nullptr;
+    mappedLength = 0;
+    mappedRelease = nullptr;
+}
+
+// ========== CARE SCHEDULE ==========
+
+void PlantStore::setCareSchedule(CareTimerWheel* schedule) {
+    careSchedule = schedule;
+}
+
+CareTimerWheel* PlantStore::getCareSchedule() const {
+    return careSchedule;
+}
+
+void PlantStore::careChanged(size_t slot, CareTask task) {
+    if (careSchedule) {
+        careSchedule->reschedule(slot, task);
+    }
+    valuesChanged(slot);
+}
+
+void PlantStore::careChangedAll(size_t slot) {
+    if (careSchedule) {
+        careSchedule->rescheduleAll(slot);
+    }
+    valuesChanged(slot);
+}
+
+// ========== OBSERVERS ==========
+
+void PlantStore::addObserver(PlantStoreObserver* observer) {
+    if (observer && std::find(observers.begin(), observers.end(), observer) == observers.end()) {
+        observers.push_back(observer);
+    }
+}
+
+void PlantStore::removeObserver(PlantStoreObserver* observer) {
+    observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+}
+
+void PlantStore::valuesChanged(size_t slot) {
+    if (observers.empty() || owner[slot] == nullptr) {
+        return;
+    }
+    for (PlantStoreObserver* observer : observers) {
+        observer->plantChanged(owner[slot]);
+    }
+}
+
+// ========== BULK SIMULATION ==========
+
+int64_t PlantStore::getDaysTicked() const {
+    return daysTicked;
+}
+
+void PlantStore::tickAll(int days) {
+    if (days <= 0) {
+        return;
+    }
+    SimulationClock::getInstance().advance(days);
+    daysTicked += days;
+    if (owner.empty()) {
+        if (careSchedule) {
+            careSchedule->advance(days);
+        }
+        return;
+    }
+
+    // Free slots are ticked too (they hold harmless defaults and are reset on reuse),
+    // which keeps the kernel free of per-row liveness branches
+    PlantUpdateKernel::Columns cols;
+    cols.age = age.data();
+    cols.currentGrowthDays = currentGrowthDays.data();
+    cols.healthLevel = healthLevel.data();
+    cols.height = height.data();
+    cols.readyForSale = readyForSale.data();
+    cols.daysToMaturity = daysToMaturity.data();
+    cols.wateringFrequency = wateringFrequency.data();
+    cols.fertilizingFrequency = fertilizingFrequency.data();
+    cols.timesWatered = timesWatered.data();
+    cols.timesFertilized = timesFertilized.data();
+
+    std::vector<size_t> newlyMature;
+    PlantUpdateKernel::run(cols, owner.size(), days, &newlyMature);
+
+    if (careSchedule) {
+        careSchedule->advance(days);
+    }
+    for (PlantStoreObserver* observer : observers) {
+        observer->storeTicked();
+    }
+
+    for (size_t slot : newlyMature) {
+        if (owner[slot]) {
+            LOG_INFO(owner[slot]->getSpecies() << " #" << plantId[slot]
+                     << " is now mature and ready for sale!");
+        }
+    }
+}
+
+void PlantStore::evaluateAttention(AttentionBitmaps& out) const {
+    PlantAttentionKernel::Columns cols;
+    cols.age = age.data();
+    cols.healthLevel = healthLevel.data();
+    cols.height = height.data();
+    cols.wateringFrequency = wateringFrequency.data();
+    cols.fertilizingFrequency = fertilizingFrequency.data();
+    cols.timesWatered = timesWatered.data();
+    cols.timesFertilized = timesFertilized.data();
+    cols.timesPruned = timesPruned.data();
+    cols.owner = owner.data();
+    PlantAttentionKernel::run(cols, owner.size(), out);
+}
@@ -0,0 +1,224 @@
+#ifndef PLANTSTORE_H
+#define PLANTSTORE_H
+
+#include "StoreColumn.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class AttentionBitmaps;
+class Plant;
+class CareTimerWheel;
+class PlantLeafIndex;
+class PlantStoreObserver;
+class SpeciesTraits;
+enum class CareTask;
+
+/**
+ * @brief Columnar (structure-of-arrays) storage for the numeric plant attributes
+ *
+ * Every Plant is a thin handle onto one slot of a PlantStore. The values that
+ * the daily simulation touches live in contiguous columns, so tickAll() can
+ * advance a whole greenhouse in one linear pass instead of visiting plants one
+ * heap object at a time.
+ *
+ * Slots are stable for the lifetime of the plant that owns them; released
+ * slots go onto a free list and are reused by the next allocation.
+ */
+class PlantStore {
+private:
+    // ========== HOT COLUMNS (touched every tick) ==========
+    StoreColumn<int> age;                     // Age in days
+    StoreColumn<int> currentGrowthDays;       // Days since planting
+    StoreColumn<int> daysToMaturity;          // Days until ready for sale
+    StoreColumn<int> healthLevel;             // 0-100 health percentage
+    StoreColumn<double> height;               // Height in cm
+    StoreColumn<int> wateringFrequency;       // Days between watering
+    StoreColumn<int> fertilizingFrequency;    // Days between fertilizing
+    StoreColumn<int> timesWatered;            // Total watering count
+    StoreColumn<int> timesFertilized;         // Total fertilizing count
+    StoreColumn<unsigned char> readyForSale;  // 0/1 (not vector<bool>, which is not contiguous)
+
+    // ========== COLD COLUMNS ==========
+    StoreColumn<int> plantId;
+    StoreColumn<double> basePrice;
+    StoreColumn<int> sunlightRequirement;
+    StoreColumn<int> timesPruned;
+    StoreColumn<int> shelfNumber;
+    StoreColumn<int64_t> lastWatered;         // SimulationClock timestamps (NEVER if not yet)
+    StoreColumn<int64_t> lastFertilized;
+    StoreColumn<int64_t> lastPruned;
+
+    // ========== SLOT BOOKKEEPING ==========
+    std::vector<Plant*> owner;                // Handle bound to each slot (nullptr if free)
+    std::vector<uint32_t> generation;         // Bumped on every release (see PlantHandle)
+    std::vector<size_t> freeSlots;            // Released slots available for reuse
+    size_t liveCount;
+    int64_t daysTicked;                       // Total days advanced by tickAll()
+
+    CareTimerWheel* careSchedule;             // Due-date wheel kept in sync with the columns (optional)
+    std::unique_ptr<PlantLeafIndex> leafIndex;   // Leaves showing this store's plants (see PlantLeafIndex::forStore())
+    std::vector<PlantStoreObserver*> observers;  // Notified when plant values change
+
+    // ========== MAPPED SNAPSHOT ==========
+    void* mappedBase;                         // Snapshot image the columns may point into
+    size_t mappedLength;
+    void (*mappedRelease)(void* base, size_t length);
+    size_t adoptSlot;                         // Slot the next allocate() binds to (NO_SLOT if none)
+    bool lastAllocationAdopted;
+
+    static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+
+    void releaseMapping();
+
+    void resetSlot(size_t slot);
+    void careChanged(size_t slot, CareTask task);
+    void careChangedAll(size_t slot);
+    void valuesChanged(size_t slot);
+
+    friend class Plant;
+    friend class CareTimerWheel;
+    friend class PlantLeafIndex;
+    friend class PlantSnapshot;
+    friend class MappedSnapshot;
+
+public:
+    PlantStore();
+    ~PlantStore();
+
+    PlantStore(const PlantStore&) = delete;
+    PlantStore& operator=(const PlantStore&) = delete;
+
+    /**
+     * @brief Store used by plants that are not given one explicitly
+     */
+    static PlantStore& getInstance();
+
+    /**
+     * @brief Bind a new slot to a plant handle
+     * @param plant Handle that will own the slot
+     * @return Slot index (initialised with Plant() defaults)
+     */
+    size_t allocate(Plant* plant);
+
+    /**
+     * @brief Append a contiguous run of unbound slots for a batch of plants
+     *
+     * The slots get Plant() defaults, the species defaults of 'traits' (if
+     * given) and consecutive plant IDs, filled column by column. Bind a handle
+     * to each with adoptNextAllocation().
+     *
+     * @param count Number of slots
+     * @param traits Species whose care defaults to apply (nullptr for Plant() defaults)
+     * @param firstId Plant ID of the first slot
+     * @return Index of the first slot
+     */
+    size_t appendSlots(size_t count, const SpeciesTraits* traits, int firstId);
+
+    /**
+     * @brief Return a slot to the free list
+     * @param slot Slot previously returned by allocate()
+     */
+    void release(size_t slot);
+
+    /**
+     * @brief Pre-size every column for a known population
+     * @param count Number of slots to reserve
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Number of live plants in the store
+     */
+    size_t size() const;
+
+    /**
+     * @brief Number of slots (live and free) - the length of every column
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Plant handle that owns a slot
+     * @return Owning plant, or nullptr if the slot is free
+     */
+    Plant* getPlant(size_t slot) const;
+
+    /**
+     * @brief Number of times a slot has been released
+     */
+    uint32_t getGeneration(size_t slot) const;
+
+    /**
+     * @brief Plant in a slot if the slot is still at the given generation
+     * @return Owning plant, or nullptr if it has been released since
+     */
+    Plant* resolve(size_t slot, uint32_t expectedGeneration) const;
+
+    /**
+     * @brief Attach the care timer wheel that tracks this store's due dates
+     * @param schedule Wheel to notify of care changes (nullptr to detach)
+     */
+    void setCareSchedule(CareTimerWheel* schedule);
+
+    CareTimerWheel* getCareSchedule() const;
+
+    /**
+     * @brief Register an observer of value changes (ignored if already registered)
+     */
+    void addObserver(PlantStoreObserver* observer);
+
+    void removeObserver(PlantStoreObserver* observer);
+
+    /**
+     * @brief Make the next allocate() bind to an existing, already-filled slot
+     *
+     * Used when restoring plants whose values are already in the columns
+     * (e.g. a memory-mapped snapshot): the slot is not reset and the species
+     * defaults are not re-applied.
+     */
+    void adoptNextAllocation(size_t slot);
+
+    /**
+     * @brief Whether the most recent allocate() bound to an adopted slot (clears the flag)
+     */
+    bool takeAdoptedAllocation();
+
+    /**
+     * @brief Whether the store holds a mapped snapshot image (see MappedSnapshot)
+     */
+    bool isMapped() const;
+
+    /**
+     * @brief Advance every live plant by the given number of days
+     *
+     * Same semantics as calling Plant::update() once per day on each plant,
+     * but evaluated column-wise over the whole store by PlantUpdateKernel.
+     * An attached CareTimerWheel and the SimulationClock are advanced by the
+     * same number of days.
+     *
+     * @param days Number of simulation days to advance
+     */
+    void tickAll(int days = 1);
+
+    /**
+     * @brief Total number of days tickAll() has advanced this store
+     *
+     * Every slot's growth advances by the same amount per tick, so
+     * "remaining days to maturity + getDaysTicked()" stays constant for a
+     * plant across ticks; indexes use it as a tick-independent maturity key.
+     */
+    int64_t getDaysTicked() const;
+
+    /**
+     * @brief Evaluate the needsAttention() checks for every slot in one pass
+     *
+     * Bit i of each bitmap is the corresponding check for the plant in slot i,
+     * as Plant::needsWater() etc. would report it; free slots are clear.
+     *
+     * @param out Receives one bitmap per AttentionReason
+     */
+    void evaluateAttention(AttentionBitmaps& out) const;
+};
+
+#endif // PLANTSTORE_H
@@ -0,0 +1,35 @@
+#ifndef PLANTSTOREOBSERVER_H
+#define PLANTSTOREOBSERVER_H
+
+class Plant;
+
+/**
+ * @brief Receives change notifications from a PlantStore
+ *
+ * Structures derived from plant values (inventory indexes, running totals)
+ * register here to stay current without rescanning. plantChanged() fires
+ * after a setter or care action changes a plant's values; storeTicked()
+ * fires after tickAll() has advanced every slot at once. plantReleased()
+ * fires while a plant is being destroyed, before its slot is freed.
+ */
+class PlantStoreObserver {
+public:
+    virtual ~PlantStoreObserver() = default;
+
+    /**
+     * @brief Values of one plant changed (also fired while a plant is being constructed)
+     */
+    virtual void plantChanged(Plant* plant) = 0;
+
+    /**
+     * @brief tickAll() changed the values of every plant in the store
+     */
+    virtual void storeTicked() = 0;
+
+    /**
+     * @brief A plant is being destroyed (its getters still work; optional)
+     */
+    virtual void plantReleased(Plant*) {}
+};
+
+#endif // PLANTSTOREOBSERVER_H
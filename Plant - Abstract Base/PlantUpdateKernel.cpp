@@ -0,0 +1,300 @@
+#include "PlantUpdateKernel.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define PLANT_KERNEL_X86 1
+#include <immintrin.h>
+#else
+#define PLANT_KERNEL_X86 0
+#endif
+
+// AVX2 is compiled per-function via target attributes, so no global -mavx2 is needed
+#if PLANT_KERNEL_X86 && (defined(__GNUC__) || defined(__clang__))
+#define PLANT_KERNEL_AVX2 1
+#else
+#define PLANT_KERNEL_AVX2 0
+#endif
+
+namespace {
+
+bool levelForced = false;
+PlantUpdateKernel::Level forcedLevel = PlantUpdateKernel::Level::Scalar;
+
+PlantUpdateKernel::Level detectLevel() {
+#if PLANT_KERNEL_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return PlantUpdateKernel::Level::AVX2;
+    }
+#endif
+#if PLANT_KERNEL_X86
+    return PlantUpdateKernel::Level::SSE2;  // Baseline on x86-64
+#else
+    return PlantUpdateKernel::Level::Scalar;
+#endif
+}
+
+// ========== SCALAR PATH (reference semantics, also used for tails) ==========
+
+void runScalar(const PlantUpdateKernel::Columns& c, size_t begin, size_t end, int days,
+               std::vector<size_t>* newlyMature) {
+    for (size_t i = begin; i < end; i++) {
+        int age = c.age[i];
+        int growth = c.currentGrowthDays[i];
+        int health = c.healthLevel[i];
+        double height = c.height[i];
+        bool ready = c.readyForSale[i] != 0;
+        const bool wasReady = ready;
+
+        for (int d = 0; d < days; d++) {
+            age++;
+            growth++;
+            if (growth >= c.daysToMaturity[i]) ready = true;
+
+            if (c.timesWatered[i] < age / c.wateringFrequency[i]) health -= 2;
+            if (health < 0) health = 0;
+            if (c.timesFertilized[i] < age / c.fertilizingFrequency[i]) health -= 1;
+            if (health < 0) health = 0;
+
+            if (health > 70) height += 0.5;
+        }
+
+        c.age[i] = age;
+        c.currentGrowthDays[i] = growth;
+        c.healthLevel[i] = health;
+        c.height[i] = height;
+        c.readyForSale[i] = ready ? 1 : 0;
+        if (ready && !wasReady && newlyMature) {
+            newlyMature->push_back(i);
+        }
+    }
+}
+
+void storeReadyBits(const PlantUpdateKernel::Columns& c, size_t base, int lanes,
+                    int readyBits, int newBits, std::vector<size_t>* newlyMature) {
+    for (int lane = 0; lane < lanes; lane++) {
+        c.readyForSale[base + lane] = static_cast<unsigned char>((readyBits >> lane) & 1);
+        if (newlyMature && ((newBits >> lane) & 1)) {
+            newlyMature->push_back(base + lane);
+        }
+    }
+}
+
+#if PLANT_KERNEL_X86
+
+// ========== SSE2 PATH (4 plants per instruction) ==========
+
+inline __m128i quotientSSE2(__m128i numerator, __m128d denomLo, __m128d denomHi) {
+    // int32 / int32 is exact through double: the quotient never rounds up to the next integer
+    __m128d numLo = _mm_cvtepi32_pd(numerator);
+    __m128d numHi = _mm_cvtepi32_pd(_mm_shuffle_epi32(numerator, _MM_SHUFFLE(1, 0, 3, 2)));
+    __m128i qLo = _mm_cvttpd_epi32(_mm_div_pd(numLo, denomLo));
+    __m128i qHi = _mm_cvttpd_epi32(_mm_div_pd(numHi, denomHi));
+    return _mm_unpacklo_epi64(qLo, qHi);
+}
+
+inline __m128d selectSSE2(__m128d mask, __m128d ifSet, __m128d ifClear) {
+    return _mm_or_pd(_mm_and_pd(mask, ifSet), _mm_andnot_pd(mask, ifClear));
+}
+
+size_t runSSE2(const PlantUpdateKernel::Columns& c, size_t count, int days,
+               std::vector<size_t>* newlyMature) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128i seventy = _mm_set1_epi32(70);
+    const __m128i allOnes = _mm_set1_epi32(-1);
+    const __m128d half = _mm_set1_pd(0.5);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i age = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.age + i));
+        __m128i growth = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.currentGrowthDays + i));
+        __m128i health = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.healthLevel + i));
+        const __m128i maturity = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.daysToMaturity + i));
+        const __m128i watered = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.timesWatered + i));
+        const __m128i fertilized = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.timesFertilized + i));
+        const __m128i waterEvery = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.wateringFrequency + i));
+        const __m128i fertilizeEvery = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.fertilizingFrequency + i));
+        __m128d heightLo = _mm_loadu_pd(c.height + i);
+        __m128d heightHi = _mm_loadu_pd(c.height + i + 2);
+
+        int readyBytes = c.readyForSale[i] | (c.readyForSale[i + 1] << 8)
+                       | (c.readyForSale[i + 2] << 16) | (c.readyForSale[i + 3] << 24);
+        __m128i ready = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(readyBytes), zero), zero);
+        __m128i readyMask = _mm_cmpgt_epi32(ready, zero);
+        const __m128i wasReady = readyMask;
+
+        const __m128d waterLo = _mm_cvtepi32_pd(waterEvery);
+        const __m128d waterHi = _mm_cvtepi32_pd(_mm_shuffle_epi32(waterEvery, _MM_SHUFFLE(1, 0, 3, 2)));
+        const __m128d fertLo = _mm_cvtepi32_pd(fertilizeEvery);
+        const __m128d fertHi = _mm_cvtepi32_pd(_mm_shuffle_epi32(fertilizeEvery, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        for (int d = 0; d < days; d++) {
+            age = _mm_add_epi32(age, one);
+            growth = _mm_add_epi32(growth, one);
+            // growth >= maturity  <=>  !(maturity > growth)
+            readyMask = _mm_or_si128(readyMask, _mm_xor_si128(_mm_cmpgt_epi32(maturity, growth), allOnes));
+
+            __m128i needsWater = _mm_cmpgt_epi32(quotientSSE2(age, waterLo, waterHi), watered);
+            health = _mm_sub_epi32(health, _mm_and_si128(needsWater, two));
+            health = _mm_andnot_si128(_mm_cmplt_epi32(health, zero), health);
+
+            __m128i needsFertilizer = _mm_cmpgt_epi32(quotientSSE2(age, fertLo, fertHi), fertilized);
+            health = _mm_sub_epi32(health, _mm_and_si128(needsFertilizer, one));
+            health = _mm_andnot_si128(_mm_cmplt_epi32(health, zero), health);
+
+            __m128i healthy = _mm_cmpgt_epi32(health, seventy);
+            __m128d growLo = _mm_castsi128_pd(_mm_unpacklo_epi32(healthy, healthy));
+            __m128d growHi = _mm_castsi128_pd(_mm_unpackhi_epi32(healthy, healthy));
+            heightLo = selectSSE2(growLo, _mm_add_pd(heightLo, half), heightLo);
+            heightHi = selectSSE2(growHi, _mm_add_pd(heightHi, half), heightHi);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(c.age + i), age);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(c.currentGrowthDays + i), growth);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(c.healthLevel + i), health);
+        _mm_storeu_pd(c.height + i, heightLo);
+        _mm_storeu_pd(c.height + i + 2, heightHi);
+
+        int readyBits = _mm_movemask_ps(_mm_castsi128_ps(readyMask));
+        int newBits = _mm_movemask_ps(_mm_castsi128_ps(_mm_andnot_si128(wasReady, readyMask)));
+        storeReadyBits(c, i, 4, readyBits, newBits, newlyMature);
+    }
+    return i;
+}
+
+#endif // PLANT_KERNEL_X86
+
+#if PLANT_KERNEL_AVX2
+
+// ========== AVX2 PATH (8 plants per instruction) ==========
+
+__attribute__((target("avx2")))
+inline __m256i quotientAVX2(__m256i numerator, __m256d denomLo, __m256d denomHi) {
+    __m256d numLo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(numerator));
+    __m256d numHi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(numerator, 1));
+    __m128i qLo = _mm256_cvttpd_epi32(_mm256_div_pd(numLo, denomLo));
+    __m128i qHi = _mm256_cvttpd_epi32(_mm256_div_pd(numHi, denomHi));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(qLo), qHi, 1);
+}
+
+__attribute__((target("avx2")))
+size_t runAVX2(const PlantUpdateKernel::Columns& c, size_t count, int days,
+               std::vector<size_t>* newlyMature) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256i seventy = _mm256_set1_epi32(70);
+    const __m256i allOnes = _mm256_set1_epi32(-1);
+    const __m256d half = _mm256_set1_pd(0.5);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i age = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.age + i));
+        __m256i growth = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.currentGrowthDays + i));
+        __m256i health = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.healthLevel + i));
+        const __m256i maturity = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.daysToMaturity + i));
+        const __m256i watered = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.timesWatered + i));
+        const __m256i fertilized = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.timesFertilized + i));
+        const __m256i waterEvery = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.wateringFrequency + i));
+        const __m256i fertilizeEvery = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.fertilizingFrequency + i));
+        __m256d heightLo = _mm256_loadu_pd(c.height + i);
+        __m256d heightHi = _mm256_loadu_pd(c.height + i + 4);
+
+        __m256i ready = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(c.readyForSale + i)));
+        __m256i readyMask = _mm256_cmpgt_epi32(ready, zero);
+        const __m256i wasReady = readyMask;
+
+        const __m256d waterLo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(waterEvery));
+        const __m256d waterHi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(waterEvery, 1));
+        const __m256d fertLo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(fertilizeEvery));
+        const __m256d fertHi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(fertilizeEvery, 1));
+
+        for (int d = 0; d < days; d++) {
+            age = _mm256_add_epi32(age, one);
+            growth = _mm256_add_epi32(growth, one);
+            readyMask = _mm256_or_si256(readyMask, _mm256_xor_si256(_mm256_cmpgt_epi32(maturity, growth), allOnes));
+
+            __m256i needsWater = _mm256_cmpgt_epi32(quotientAVX2(age, waterLo, waterHi), watered);
+            health = _mm256_sub_epi32(health, _mm256_and_si256(needsWater, two));
+            health = _mm256_max_epi32(health, zero);
+
+            __m256i needsFertilizer = _mm256_cmpgt_epi32(quotientAVX2(age, fertLo, fertHi), fertilized);
+            health = _mm256_sub_epi32(health, _mm256_and_si256(needsFertilizer, one));
+            health = _mm256_max_epi32(health, zero);
+
+            // Blend rather than add 0.0 so untouched heights keep their exact bits (e.g. -0.0)
+            __m256i healthy = _mm256_cmpgt_epi32(health, seventy);
+            __m256d growLo = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(healthy)));
+            __m256d growHi = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(healthy, 1)));
+            heightLo = _mm256_blendv_pd(heightLo, _mm256_add_pd(heightLo, half), growLo);
+            heightHi = _mm256_blendv_pd(heightHi, _mm256_add_pd(heightHi, half), growHi);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(c.age + i), age);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(c.currentGrowthDays + i), growth);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(c.healthLevel + i), health);
+        _mm256_storeu_pd(c.height + i, heightLo);
+        _mm256_storeu_pd(c.height + i + 4, heightHi);
+
+        int readyBits = _mm256_movemask_ps(_mm256_castsi256_ps(readyMask));
+        int newBits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(wasReady, readyMask)));
+        storeReadyBits(c, i, 8, readyBits, newBits, newlyMature);
+    }
+    return i;
+}
+
+#endif // PLANT_KERNEL_AVX2
+
+} // namespace
+
+// ========== DISPATCH ==========
+
+void PlantUpdateKernel::run(const Columns& cols, size_t count, int days,
+                            std::vector<size_t>* newlyMature) {
+    if (count == 0 || days <= 0) {
+        return;
+    }
+
+    size_t done = 0;
+    switch (activeLevel()) {
+#if PLANT_KERNEL_AVX2
+        case Level::AVX2:
+            done = runAVX2(cols, count, days, newlyMature);
+            break;
+#endif
+#if PLANT_KERNEL_X86
+        case Level::SSE2:
+            done = runSSE2(cols, count, days, newlyMature);
+            break;
+#endif
+        default:
+            break;
+    }
+    runScalar(cols, done, count, days, newlyMature);
+}
+
+PlantUpdateKernel::Level PlantUpdateKernel::activeLevel() {
+    static const Level detected = detectLevel();
+    if (levelForced && static_cast<int>(forcedLevel) < static_cast<int>(detected)) {
+        return forcedLevel;
+    }
+    return detected;
+}
+
+void PlantUpdateKernel::forceLevel(Level level) {
+    levelForced = true;
+    forcedLevel = level;
+}
+
+void PlantUpdateKernel::clearForcedLevel() {
+    levelForced = false;
+}
+
+std::string PlantUpdateKernel::levelName(Level level) {
+    switch (level) {
+        case Level::AVX2: return "AVX2";
+        case Level::SSE2: return "SSE2";
+        default: return "Scalar";
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef PLANTUPDATEKERNEL_H
+#define PLANTUPDATEKERNEL_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Vectorised evaluation of the Plant::update() rules over store columns
+ *
+ * Per day and per plant:
+ *   age++, currentGrowthDays++ (becomes readyForSale once mature),
+ *   health -= 2 if needsWater(), health -= 1 if needsFertilizer() (clamped at 0),
+ *   height += 0.5 if health > 70.
+ *
+ * The rules are evaluated branch-free with lane masks, 8 plants per AVX2
+ * instruction or 4 per SSE2 instruction, with a scalar loop for the tail and
+ * for non-x86 targets. The widest path the CPU supports is chosen at runtime.
+ * Results are bit-identical to the scalar Plant::update() for every path
+ * (the age / frequency quotient is computed exactly in double precision).
+ */
+class PlantUpdateKernel {
+public:
+    enum class Level {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    /**
+     * @brief Column pointers the kernel reads and writes (all of equal length)
+     */
+    struct Columns {
+        int* age;
+        int* currentGrowthDays;
+        int* healthLevel;
+        double* height;
+        unsigned char* readyForSale;
+        const int* daysToMaturity;
+        const int* wateringFrequency;
+        const int* fertilizingFrequency;
+        const int* timesWatered;
+        const int* timesFertilized;
+    };
+
+    /**
+     * @brief Advance every row by the given number of days
+     * @param cols Column pointers
+     * @param count Number of rows
+     * @param days Number of simulation days
+     * @param newlyMature Receives the rows that became ready for sale (may be nullptr)
+     */
+    static void run(const Columns& cols, size_t count, int days,
+                    std::vector<size_t>* newlyMature);
+
+    /**
+     * @brief Widest instruction set usable on this CPU (or the forced level)
+     */
+    static Level activeLevel();
+
+    /**
+     * @brief Pin the kernel to a level (clamped to what the CPU supports)
+     * @param level Level to use for subsequent runs
+     */
+    static void forceLevel(Level level);
+
+    /**
+     * @brief Return to automatic CPU feature detection
+     */
+    static void clearForcedLevel();
+
+    static std::string levelName(Level level);
+};
+
+#endif // PLANTUPDATEKERNEL_H
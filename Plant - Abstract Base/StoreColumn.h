@@ -0,0 +1,129 @@
+#ifndef STORECOLUMN_H
+#define STORECOLUMN_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+/**
+ * @brief Growable array of plain values used for the PlantStore columns
+ *
+ * Behaves like the subset of std::vector the store needs, but can also wrap
+ * memory it does not own (a column of a memory-mapped snapshot). A wrapped
+ * column is used in place; it is only copied to the heap when it has to grow.
+ */
+template <typename T>
+class StoreColumn {
+    static_assert(std::is_trivially_copyable<T>::value, "StoreColumn holds plain values only");
+
+private:
+    T* items;
+    size_t count;
+    size_t cap;
+    bool external;   // items points into memory owned elsewhere
+
+    void grow(size_t newCap) {
+        T* fresh = static_cast<T*>(std::malloc(newCap * sizeof(T)));
+        if (!fresh) {
+            throw std::bad_alloc();
+        }
+        if (count > 0) {
+            std::memcpy(fresh, items, count * sizeof(T));
+        }
+        if (!external) {
+            std::free(items);
+        }
+        items = fresh;
+        cap = newCap;
+        external = false;
+    }
+
+public:
+    StoreColumn() : items(nullptr), count(0), cap(0), external(false) {}
+
+    ~StoreColumn() {
+        if (!external) {
+            std::free(items);
+        }
+    }
+
+    StoreColumn(const StoreColumn&) = delete;
+    StoreColumn& operator=(const StoreColumn&) = delete;
+
+    T& operator[](size_t i) { return items[i]; }
+    const T& operator[](size_t i) const { return items[i]; }
+
+    T* data() { return items; }
+    const T* data() const { return items; }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    bool isExternal() const { return external; }
+
+    void push_back(const T& value) {
+        if (count == cap) {
+            grow(cap ? cap * 2 : 16);
+        }
+        items[count++] = value;
+    }
+
+    void reserve(size_t n) {
+        if (n > cap) {
+            grow(n);
+        }
+    }
+
+    /**
+     * @brief Grow (or shrink) to n elements, filling new ones with value
+     */
+    void resize(size_t n, const T& value) {
+        if (n > cap) {
+            size_t newCap = cap ? cap * 2 : 16;
+            grow(newCap < n ? n : newCap);
+        }
+        for (size_t i = count; i < n; i++) {
+            items[i] = value;
+        }
+        count = n;
+    }
+
+    /**
+     * @brief Append a block of values
+     */
+    void append(const T* values, size_t n) {
+        if (count + n > cap) {
+            size_t newCap = cap ? cap * 2 : 16;
+            grow(newCap < count + n ? count + n : newCap);
+        }
+        std::memcpy(items + count, values, n * sizeof(T));
+        count += n;
+    }
+
+    /**
+     * @brief Use existing memory as the column contents (not copied, not freed)
+     * @param values First element; must stay valid while the column refers to it
+     * @param n Number of elements
+     */
+    void wrap(T* values, size_t n) {
+        if (!external) {
+            std::free(items);
+        }
+        items = values;
+        count = n;
+        cap = n;
+        external = true;
+    }
+
+    void clear() {
+        if (external) {
+            items = nullptr;
+            cap = 0;
+            external = false;
+        }
+        count = 0;
+    }
+};
+
+#endif // STORECOLUMN_H
@@ -1,20 +1,20 @@
 #include "DormantState.h"
 #include "PlantContext.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void DormantState::water(PlantContext* context) {
-    std::cout << "Minimizing water for dormant plant to prevent rot.\n";
+    LOG_INFO("Minimizing water for dormant plant to prevent rot.");
     if (context->getPlant()) {
         context->getPlant()->modifyHealth(5);
     }
 }
 
 void DormantState::fertilize(PlantContext* context) {
-    std::cout << "No fertilizing needed for dormant plant.\n";
+    LOG_INFO("No fertilizing needed for dormant plant.");
 }
 
 void DormantState::checkHealth(PlantContext* context) {
-    std::cout << "Checking dormant plant health: Awaiting active growth season.\n";
+    LOG_INFO("Checking dormant plant health: Awaiting active growth season.");
     // Placeholder logic: Transition to GrowingState when conditions improve
     // if (/* season changes */) context->setState(new GrowingState());
 }
\ No newline at end of file
@@ -1,23 +1,23 @@
 #include "FloweringState.h"
 #include "PlantContext.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void FloweringState::water(PlantContext* context) {
-    std::cout << "Watering flowering plant with extra care to support blooms.\n";
+    LOG_INFO("Watering flowering plant with extra care to support blooms.");
     if (context->getPlant()) {
         context->getPlant()->modifyHealth(15);
     }
 }
 
 void FloweringState::fertilize(PlantContext* context) {
-    std::cout << "Applying bloom-boosting fertilizer.\n";
+    LOG_INFO("Applying bloom-boosting fertilizer.");
     if (context->getPlant()) {
         context->getPlant()->modifyHealth(10);
     }
 }
 
 void FloweringState::checkHealth(PlantContext* context) {
-    std::cout << "Checking flowering plant health: Blooms indicate peak health.\n";
+    LOG_INFO("Checking flowering plant health: Blooms indicate peak health.");
     // Placeholder logic: Transition back to MatureState after flowering
     // if (/* flowering period ends */) context->setState(new MatureState());
 }
\ No newline at end of file
@@ -1,26 +1,26 @@
 #include "GrowingState.h"
 #include "MatureState.h"
 #include "PlantContext.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void GrowingState::water(PlantContext* context) {
-    std::cout << "Watering growing plant with moderate amounts.\n";
+    LOG_INFO("Watering growing plant with moderate amounts.");
     if (context->getPlant()) {
         context->getPlant()->modifyHealth(15);
     }
 }
 
 void GrowingState::fertilize(PlantContext* context) {
-    std::cout << "Applying balanced fertilizer to support growth.\n";
+    LOG_INFO("Applying balanced fertilizer to support growth.");
     if (context->getPlant()) {
         context->getPlant()->modifyHealth(10);
     }
 }
 
 void GrowingState::checkHealth(PlantContext* context) {
-    std::cout << "Checking growing plant health: Progressing towards Mature state.\n";
+    LOG_INFO("Checking growing plant health: Progressing towards Mature state.");
     if (context->getPlant() && context->getPlant()->getHealthLevel() > 80) {
-        std::cout << "Plant is healthy enough to transition to Mature state.\n";
+        LOG_INFO("Plant is healthy enough to transition to Mature state.");
         context->setState(new MatureState());
     }
 }
\ No newline at end of file
@@ -1,23 +1,23 @@
 #include "MatureState.h"
 #include "PlantContext.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void MatureState::water(PlantContext* context) {
-    std::cout << "Watering mature plant with regular schedule.\n";
+    LOG_INFO("Watering mature plant with regular schedule.");
     if (context->getPlant()) {
         context->getPlant()->modifyHealth(10);
     }
 }
 
 void MatureState::fertilize(PlantContext* context) {
-    std::cout << "Applying maintenance fertilizer to mature plant.\n";
+    LOG_INFO("Applying maintenance fertilizer to mature plant.");
     if (context->getPlant()) {
         context->getPlant()->modifyHealth(5);
     }
 }
 
 void MatureState::checkHealth(PlantContext* context) {
-    std::cout << "Checking mature plant health: Stable, can transition to Flowering or Dormant.\n";
+    LOG_INFO("Checking mature plant health: Stable, can transition to Flowering or Dormant.");
     // Placeholder logic: Manual transition for test (e.g., season-based)
     // For this example, we'll allow manual transition in main.cpp
 }
\ No newline at end of file
@@ -1,15 +1,15 @@
 #include "PlantState.h"
 #include "PlantContext.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void PlantState::water(PlantContext* context) {
-    std::cout << "Default watering behavior for unspecified state.\n";
+    LOG_INFO("Default watering behavior for unspecified state.");
 }
 
 void PlantState::fertilize(PlantContext* context) {
-    std::cout << "Default fertilizing behavior for unspecified state.\n";
+    LOG_INFO("Default fertilizing behavior for unspecified state.");
 }
 
 void PlantState::checkHealth(PlantContext* context) {
-    std::cout << "Default health check for unspecified state.\n";
+    LOG_INFO("Default health check for unspecified state.");
 }
\ No newline at end of file
@@ -1,26 +1,26 @@
 #include "SeedlingState.h"
 #include "PlantContext.h"
 #include "GrowingState.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void SeedlingState::water(PlantContext* context) {
-    std::cout << "Watering seedling with small amounts to avoid overwatering.\n";
+    LOG_INFO("Watering seedling with small amounts to avoid overwatering.");
     if (context->getPlant()) {
         context->getPlant()->modifyHealth(10);
     }
 }
 
 void SeedlingState::fertilize(PlantContext* context) {
-    std::cout << "Applying light fertilizer to seedling for growth.\n";
+    LOG_INFO("Applying light fertilizer to seedling for growth.");
     if (context->getPlant()) {
         context->getPlant()->modifyHealth(5);
     }
 }
 
 void SeedlingState::checkHealth(PlantContext* context) {
-    std::cout << "Checking seedling health: Requires frequent care to progress to Growing state.\n";
+    LOG_INFO("Checking seedling health: Requires frequent care to progress to Growing state.");
     if (context->getPlant() && context->getPlant()->getHealthLevel() > 50) {
-        std::cout << "Seedling is healthy enough to transition to Growing state.\n";
+        LOG_INFO("Seedling is healthy enough to transition to Growing state.");
         context->setState(new GrowingState());
     }
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "FrequentWatering.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void FrequentWatering::careForPlant() {
-    std::cout << "Watering daily, keeping soil consistently moist\n";
+    LOG_INFO("Watering daily, keeping soil consistently moist");
 }
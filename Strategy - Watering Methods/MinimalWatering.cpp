@@ -1,6 +1,6 @@
 #include "MinimalWatering .h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void MinimalWatering::careForPlant() {
-    std::cout << "Watering sparingly, allowing soil to dry completely between waterings\n";
+    LOG_INFO("Watering sparingly, allowing soil to dry completely between waterings");
 }
@@ -1,6 +1,6 @@
 #include "ModerateWatering.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void ModerateWatering::careForPlant() {
-    std::cout << "Watering when top inch of soil is dry, maintaining moderate moisture\n";
+    LOG_INFO("Watering when top inch of soil is dry, maintaining moderate moisture");
 }
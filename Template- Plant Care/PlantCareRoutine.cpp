@@ -1,12 +1,12 @@
 #include "PlantCareRoutine.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void PlantCareRoutine::careForPlant() {
-    std::cout << "Starting plant care routine...\n";
+    LOG_INFO("Starting plant care routine...");
     checkSoilMoisture();
     water();
     fertilize();
     prune();
     additionalCare();
-    std::cout << "Plant care routine completed.\n";
+    LOG_INFO("Plant care routine completed.");
 }
\ No newline at end of file
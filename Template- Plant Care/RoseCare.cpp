@@ -1,22 +1,22 @@
 #include "RoseCare.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void RoseCare::checkSoilMoisture() {
-    std::cout << "Checking rose soil moisture - should be consistently moist\n";
+    LOG_INFO("Checking rose soil moisture - should be consistently moist");
 }
 
 void RoseCare::water() {
-    std::cout << "Watering rose deeply at base, avoiding leaves\n";
+    LOG_INFO("Watering rose deeply at base, avoiding leaves");
 }
 
 void RoseCare::fertilize() {
-    std::cout << "Applying balanced fertilizer for roses\n";
+    LOG_INFO("Applying balanced fertilizer for roses");
 }
 
 void RoseCare::prune() {
-    std::cout << "Pruning dead roses and shaping bush\n";
+    LOG_INFO("Pruning dead roses and shaping bush");
 }
 
 void RoseCare::additionalCare() {
-    std::cout << "Checking for pests and diseases on rose leaves\n";
+    LOG_INFO("Checking for pests and diseases on rose leaves");
 }
\ No newline at end of file
@@ -1,18 +1,18 @@
 #include "SucculentCare.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void SucculentCare::checkSoilMoisture() {
-    std::cout << "Checking succulent soil - should be completely dry before watering\n";
+    LOG_INFO("Checking succulent soil - should be completely dry before watering");
 }
 
 void SucculentCare::water() {
-    std::cout << "Watering succulent sparingly, ensuring good drainage\n";
+    LOG_INFO("Watering succulent sparingly, ensuring good drainage");
 }
 
 void SucculentCare::fertilize() {
-    std::cout << "Applying diluted cactus fertilizer monthly\n";
+    LOG_INFO("Applying diluted cactus fertilizer monthly");
 }
 
 void SucculentCare::prune() {
-    std::cout << "Removing dead or damaged succulent leaves\n";
+    LOG_INFO("Removing dead or damaged succulent leaves");
 }
\ No newline at end of file
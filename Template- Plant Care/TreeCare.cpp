@@ -1,22 +1,22 @@
 #include "TreeCare.h"
-#include <iostream>
+#include "../Core - Simulation Services/Logger.h"
 
 void TreeCare::checkSoilMoisture() {
-    std::cout << "Checking tree soil moisture at root depth\n";
+    LOG_INFO("Checking tree soil moisture at root depth");
 }
 
 void TreeCare::water() {
-    std::cout << "Deep watering tree at drip line\n";
+    LOG_INFO("Deep watering tree at drip line");
 }
 
 void TreeCare::fertilize() {
-    std::cout << "Applying slow-release tree fertilizer\n";
+    LOG_INFO("Applying slow-release tree fertilizer");
 }
 
 void TreeCare::prune() {
-    std::cout << "Pruning dead branches and shaping tree canopy\n";
+    LOG_INFO("Pruning dead branches and shaping tree canopy");
 }
 
 void TreeCare::additionalCare() {
-    std::cout << "Checking tree trunk for damage and mulching base\n";
+    LOG_INFO("Checking tree trunk for damage and mulching base");
 }
\ No newline at end of file
@@ -0,0 +1,274 @@
+#include "TestSupport.h"
+#include "../Iterator - Inventory Management/ConcurrentInventory.h"
+#include "../Iterator - Inventory Management/PlantIterator.h"
+#include "../Factory - Plant Creation/RoseFactory.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include <atomic>
+#include <map>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Many-reader / many-writer stress test for ConcurrentInventory.
+ *
+ * Each writer owns its own run of plants and only ever adds the next unused
+ * one (singly or as an addPlants() batch) or removes its oldest present one,
+ * so after each of its writes its plants in the inventory form a window
+ * [lo, hi) of its run. The windows a writer passes through are planned in
+ * advance. A snapshot is linearizable if, for every writer:
+ *   - its plants form exactly one planned window (never a half-applied batch),
+ *   - the window is no older than the last write that finished before the
+ *     snapshot was taken and no newer than the last write that had started,
+ *   - and, for one reader, windows never go backwards between snapshots.
+ */
+
+namespace {
+    const int WRITERS = 4;
+    const int READERS = 4;
+    const int PLANTS_PER_WRITER = 1500;
+
+    struct Owner {
+        int writer;
+        int index;
+    };
+
+    struct Window {
+        int lo;
+        int hi;
+    };
+
+    struct Operation {
+        bool add;
+        int batch;      // Plants added by this operation (1 = addPlant)
+    };
+
+    struct Plan {
+        std::vector<Operation> operations;
+        std::map<std::pair<int, int>, int> step;   // Window after an operation -> number of operations done
+    };
+
+    Plan planWriter(unsigned seed) {
+        std::mt19937 rng(seed);
+        Plan plan;
+        Window window{0, 0};
+        plan.step[std::make_pair(0, 0)] = 0;
+        while (window.hi < PLANTS_PER_WRITER) {
+            Operation op;
+            if (window.hi - window.lo < 3 || rng() % 2 == 0) {
+                op.add = true;
+                op.batch = rng() % 8 == 0 ? 2 + static_cast<int>(rng() % 4) : 1;
+                if (window.hi + op.batch > PLANTS_PER_WRITER) {
+                    op.batch = PLANTS_PER_WRITER - window.hi;
+                }
+                window.hi += op.batch;
+            } else {
+                op.add = false;
+                op.batch = 0;
+                window.lo++;
+            }
+            plan.operations.push_back(op);
+            plan.step[std::make_pair(window.lo, window.hi)] = static_cast<int>(plan.operations.size());
+        }
+        return plan;
+    }
+
+    struct Shared {
+        ConcurrentInventory inventory;
+        std::vector<std::vector<Plant*>> runs;           // Plants of each writer, in order
+        std::unordered_map<const Plant*, Owner> owners;
+        std::vector<Plan> plans;
+        std::atomic<int> started[WRITERS];               // Operations begun by each writer
+        std::atomic<int> finished[WRITERS];              // Operations completed by each writer
+        std::atomic<bool> writing;
+        std::atomic<long> violations;
+        std::atomic<long> snapshotsChecked;
+    };
+
+    /**
+     * @brief Work out each writer's step in a list of plants; false if some writer's plants are no planned window
+     */
+    bool stepsOf(const Shared& shared, const std::vector<Plant*>& plants, int steps[WRITERS]) {
+        std::vector<std::vector<bool>> present(WRITERS, std::vector<bool>(PLANTS_PER_WRITER, false));
+        for (Plant* plant : plants) {
+            auto owner = shared.owners.find(plant);
+            if (owner == shared.owners.end() || present[owner->second.writer][owner->second.index]) {
+                return false;   // Unknown plant or duplicate
+            }
+            present[owner->second.writer][owner->second.index] = true;
+        }
+        for (int w = 0; w < WRITERS; w++) {
+            int lo = 0;
+            while (lo < PLANTS_PER_WRITER && !present[w][lo]) {
+                lo++;
+            }
+            int hi = lo;
+            while (hi < PLANTS_PER_WRITER && present[w][hi]) {
+                hi++;
+            }
+            for (int i = hi; i < PLANTS_PER_WRITER; i++) {
+                if (present[w][i]) {
+                    return false;   // Gap inside the window
+                }
+            }
+            if (lo == hi) {
+                steps[w] = 0;   // Windows never empty again once a writer has started
+                continue;
+            }
+            auto planned = shared.plans[w].step.find(std::make_pair(lo, hi));
+            if (planned == shared.plans[w].step.end()) {
+                return false;
+            }
+            steps[w] = planned->second;
+        }
+        return true;
+    }
+
+    void writer(Shared& shared, int w) {
+        const std::vector<Plant*>& run = shared.runs[w];
+        int lo = 0;
+        int hi = 0;
+        for (const Operation& op : shared.plans[w].operations) {
+            shared.started[w].fetch_add(1);
+            if (op.add && op.batch == 1) {
+                shared.inventory.addPlant(run[hi]);
+            } else if (op.add) {
+                shared.inventory.addPlants(std::vector<Plant*>(run.begin() + hi, run.begin() + hi + op.batch));
+            } else {
+                shared.inventory.removePlant(run[lo]);
+            }
+            if (op.add) {
+                hi += op.batch;
+            } else {
+                lo++;
+            }
+            shared.finished[w].fetch_add(1);
+        }
+    }
+
+    void reader(Shared& shared, int r) {
+        int lastSteps[WRITERS];
+        for (int w = 0; w < WRITERS; w++) {
+            lastSteps[w] = 0;
+        }
+        uint64_t lastVersion = 0;
+        bool viaIterator = (r % 2) == 1;
+
+        while (shared.writing.load()) {
+            int doneBefore[WRITERS];
+            for (int w = 0; w < WRITERS; w++) {
+                doneBefore[w] = shared.finished[w].load();
+            }
+
+            std::vector<Plant*> plants;
+            uint64_t version = 0;
+            bool versioned = false;
+            if (viaIterator) {
+                PlantIterator* iterator = shared.inventory.createIterator();
+                for (iterator->first(); !iterator->isDone(); iterator->next()) {
+                    plants.push_back(iterator->currentItem());
+                }
+                delete iterator;
+            } else {
+                std::shared_ptr<const ConcurrentInventory::Snapshot> snapshot = shared.inventory.snapshot();
+                plants.assign(snapshot->begin(), snapshot->end());
+                if (plants.size() != snapshot->size()) {
+                    shared.violations++;
+                }
+                version = snapshot->getVersion();
+                versioned = true;
+            }
+
+            int startedAfter[WRITERS];
+            for (int w = 0; w < WRITERS; w++) {
+                startedAfter[w] = shared.started[w].load();
+            }
+
+            int steps[WRITERS];
+            if (!stepsOf(shared, plants, steps)) {
+                shared.violations++;
+                continue;
+            }
+            if (versioned) {
+                if (version < lastVersion) {
+                    shared.violations++;
+                }
+                lastVersion = version;
+            }
+            for (int w = 0; w < WRITERS; w++) {
+                if (steps[w] < doneBefore[w] || steps[w] > startedAfter[w] || steps[w] < lastSteps[w]) {
+                    shared.violations++;
+                }
+                lastSteps[w] = steps[w];
+            }
+            shared.snapshotsChecked++;
+        }
+    }
+}
+
+int main() {
+    quietLogging();
+
+    Shared shared;
+    shared.writing.store(true);
+    shared.violations.store(0);
+    shared.snapshotsChecked.store(0);
+
+    RoseFactory roses;
+    std::vector<Plant*> allPlants;
+    roses.createPlants(WRITERS * PLANTS_PER_WRITER, allPlants);
+    for (int w = 0; w < WRITERS; w++) {
+        shared.runs.emplace_back(allPlants.begin() + w * PLANTS_PER_WRITER,
+                                 allPlants.begin() + (w + 1) * PLANTS_PER_WRITER);
+        for (int i = 0; i < PLANTS_PER_WRITER; i++) {
+            shared.owners[shared.runs[w][i]] = Owner{w, i};
+        }
+        shared.plans.push_back(planWriter(100 + w));
+        shared.started[w].store(0);
+        shared.finished[w].store(0);
+    }
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; r++) {
+        readers.emplace_back(reader, std::ref(shared), r);
+    }
+    std::vector<std::thread> writers;
+    for (int w = 0; w < WRITERS; w++) {
+        writers.emplace_back(writer, std::ref(shared), w);
+    }
+    for (std::thread& thread : writers) {
+        thread.join();
+    }
+    shared.writing.store(false);
+    for (std::thread& thread : readers) {
+        thread.join();
+    }
+
+    std::cout << "Checked " << shared.snapshotsChecked.load() << " concurrent reads" << std::endl;
+    CHECK(shared.violations.load() == 0);
+    CHECK(shared.snapshotsChecked.load() > 0);
+
+    // Quiescent state: every writer ends on its last planned window
+    std::shared_ptr<const ConcurrentInventory::Snapshot> settled = shared.inventory.snapshot();
+    std::vector<Plant*> plants(settled->begin(), settled->end());
+    int steps[WRITERS];
+    CHECK(stepsOf(shared, plants, steps));
+    size_t expected = 0;
+    for (int w = 0; w < WRITERS; w++) {
+        CHECK(steps[w] == static_cast<int>(shared.plans[w].operations.size()));
+        int lo = 0;
+        for (const Operation& op : shared.plans[w].operations) {
+            lo += op.add ? 0 : 1;
+        }
+        expected += static_cast<size_t>(PLANTS_PER_WRITER - lo);
+    }
+    CHECK(shared.inventory.getCount() == expected);
+    CHECK(settled->size() == expected);
+
+    for (Plant* plant : allPlants) {
+        delete plant;
+    }
+    return testResult("ConcurrentInventoryTest");
+}
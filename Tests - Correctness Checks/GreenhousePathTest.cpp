@@ -0,0 +1,85 @@
+#include "TestSupport.h"
+#include "../Composite - The Store layout/Greenhouse.h"
+#include "../Composite - The Store layout/GreenhouseSection.h"
+#include "../Composite - The Store layout/Shelf.h"
+#include "../Composite - The Store layout/PlantLeaf.h"
+#include "../Factory - Plant Creation/CactusFactory.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include <vector>
+
+/**
+ * Checks the Greenhouse path and shelf-number lookups: sibling shelves with
+ * the same name get distinct paths, plants record the path of their shelf,
+ * and both tables follow relocation and removal.
+ */
+
+int main() {
+    quietLogging();
+
+    CactusFactory cacti;
+    std::vector<Plant*> plants;
+    cacti.createPlants(3, plants);
+
+    Greenhouse* greenhouse = new Greenhouse("Main Greenhouse");
+    GreenhouseSection* desert = new GreenhouseSection("desert", "Desert Section");
+    Shelf* shelf4 = new Shelf(4);
+    Shelf* shelf5 = new Shelf(5);
+    shelf4->add(new PlantLeaf(plants[0], "Cactus A"));
+    shelf5->add(new PlantLeaf(plants[1], "Cactus B"));
+    desert->add(shelf4);
+    desert->add(shelf5);
+    greenhouse->add(desert);
+
+    CHECK(greenhouse->pathOf(shelf4) == "Main Greenhouse/Desert Section/Shelf 4");
+    CHECK(greenhouse->pathOf(shelf5) == "Main Greenhouse/Desert Section/Shelf 5");
+    CHECK(greenhouse->findByPath("Main Greenhouse/Desert Section/Shelf 4") == shelf4);
+    CHECK(greenhouse->findByPath("Main Greenhouse/Desert Section/Shelf 5") == shelf5);
+    CHECK(greenhouse->findByPath("Main Greenhouse/Desert Section") == desert);
+    CHECK(greenhouse->findShelf(4) == shelf4);
+    CHECK(greenhouse->findShelf(5) == shelf5);
+    CHECK(plants[0]->getLocation() == "Main Greenhouse/Desert Section/Shelf 4");
+    CHECK(plants[1]->getLocation() == "Main Greenhouse/Desert Section/Shelf 5");
+    CHECK(plants[0]->getShelfNumber() == 4);
+    CHECK(plants[0]->getShelf() == shelf4);
+
+    // Moving a plant updates the location it records
+    CHECK(greenhouse->relocatePlant(plants[0], 5));
+    CHECK(plants[0]->getLocation() == "Main Greenhouse/Desert Section/Shelf 5");
+    CHECK(plants[0]->getShelfNumber() == 5);
+    CHECK(!greenhouse->relocatePlant(plants[0], 9));   // No such shelf
+    CHECK(!greenhouse->relocatePlant(plants[2], 4));   // Not in the layout
+
+    // Detaching a shelf drops it from both tables
+    desert->remove(shelf4);
+    CHECK(greenhouse->findByPath("Main Greenhouse/Desert Section/Shelf 4") == nullptr);
+    CHECK(greenhouse->findShelf(4) == nullptr);
+    CHECK(greenhouse->findShelf(5) == shelf5);
+    delete shelf4;
+
+    // A second shelf with a taken number shadows the first only while it is attached
+    GreenhouseSection* tropical = new GreenhouseSection("tropical", "Tropical Section");
+    Shelf* otherShelf5 = new Shelf(5);
+    Shelf* twinShelf5 = new Shelf(5);
+    tropical->add(otherShelf5);
+    tropical->add(twinShelf5);
+    greenhouse->add(tropical);
+    CHECK(greenhouse->findShelf(5) == twinShelf5);
+    CHECK(greenhouse->findByPath("Main Greenhouse/Tropical Section/Shelf 5") == twinShelf5);
+    tropical->remove(twinShelf5);
+    CHECK(greenhouse->findShelf(5) == otherShelf5);
+    CHECK(greenhouse->findByPath("Main Greenhouse/Tropical Section/Shelf 5") == otherShelf5);
+    delete twinShelf5;
+    tropical->remove(otherShelf5);
+    CHECK(greenhouse->findShelf(5) == shelf5);
+    CHECK(greenhouse->findByPath("Main Greenhouse/Tropical Section/Shelf 5") == nullptr);
+    delete otherShelf5;
+    greenhouse->remove(tropical);
+    CHECK(greenhouse->findByPath("Main Greenhouse/Tropical Section") == nullptr);
+    delete tropical;
+
+    delete greenhouse;
+    for (Plant* plant : plants) {
+        delete plant;
+    }
+    return testResult("GreenhousePathTest");
+}
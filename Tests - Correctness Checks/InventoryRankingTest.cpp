@@ -0,0 +1,176 @@
+#include "TestSupport.h"
+#include "../Iterator - Inventory Management/GreenhouseInventory.h"
+#include "../Factory - Plant Creation/CactusFactory.h"
+#include "../Factory - Plant Creation/LavenderFactory.h"
+#include "../Factory - Plant Creation/PlantFactory.h"
+#include "../Factory - Plant Creation/RoseFactory.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include "../Plant - Abstract Base/PlantStore.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+/**
+ * Checks GreenhouseInventory::topK() and rankCursor() against sorting the
+ * matching plants by hand, for every rank and a spread of filters, while
+ * plants change price, health, readiness and ID, age with PlantStore::tickAll()
+ * and come and go. Equal keys must come out in plant ID order.
+ */
+
+namespace {
+    double rankKey(PlantRank rank, const Plant* plant) {
+        switch (rank) {
+            case PlantRank::Price: return plant->getBasePrice();
+            case PlantRank::Health: return static_cast<double>(plant->getHealthLevel());
+            case PlantRank::Maturity:
+                return static_cast<double>(static_cast<int64_t>(plant->getDaysToMaturity()) -
+                                           plant->getCurrentGrowthDays() +
+                                           plant->getStore()->getDaysTicked());
+        }
+        return 0.0;
+    }
+
+    /**
+     * @brief Every plant a ranking should return, in rank order
+     */
+    std::vector<Plant*> expectedRanking(const std::vector<Plant*>& held, PlantRank rank, bool highestFirst,
+                                        const InventoryQuery& filter) {
+        typedef std::tuple<double, int, const Plant*> Key;
+        std::vector<std::pair<Key, Plant*>> matching;
+        for (Plant* plant : held) {
+            if (rank == PlantRank::Maturity && plant->isReadyForSale()) {
+                continue;
+            }
+            if (InventoryIndex::matches(plant, filter)) {
+                matching.emplace_back(Key(rankKey(rank, plant), plant->getPlantId(), plant), plant);
+            }
+        }
+        std::sort(matching.begin(), matching.end());
+        if (highestFirst) {
+            std::reverse(matching.begin(), matching.end());
+        }
+        std::vector<Plant*> order;
+        for (const auto& entry : matching) {
+            order.push_back(entry.second);
+        }
+        return order;
+    }
+
+    std::vector<InventoryQuery> filters() {
+        std::vector<InventoryQuery> result(1);
+        InventoryQuery q;
+        q.species = "Rose";
+        result.push_back(q);
+        q.readyOnly = true;
+        result.push_back(q);
+        q = InventoryQuery();
+        q.readyOnly = true;
+        result.push_back(q);
+        q = InventoryQuery();
+        q.minHealth = 40;
+        q.maxHealth = 80;
+        result.push_back(q);
+        q = InventoryQuery();
+        q.minPrice = 60.0;
+        q.maxPrice = 140.0;
+        q.species = "Cactus";
+        result.push_back(q);
+        q = InventoryQuery();
+        q.attentionOnly = true;
+        result.push_back(q);
+        q = InventoryQuery();
+        q.species = "Orchid";   // Never held
+        result.push_back(q);
+        return result;
+    }
+
+    void checkRankings(const GreenhouseInventory& inventory, const std::vector<Plant*>& held) {
+        const PlantRank ranks[] = {PlantRank::Price, PlantRank::Health, PlantRank::Maturity};
+        for (PlantRank rank : ranks) {
+            for (bool highestFirst : {false, true}) {
+                for (const InventoryQuery& filter : filters()) {
+                    std::vector<Plant*> expected = expectedRanking(held, rank, highestFirst, filter);
+
+                    std::vector<Plant*> top = inventory.topK(rank, 5, highestFirst, filter);
+                    std::vector<Plant*> expectedTop(expected.begin(),
+                                                    expected.begin() + std::min<size_t>(5, expected.size()));
+                    CHECK(top == expectedTop);
+
+                    RankingCursor cursor = inventory.rankCursor(rank, highestFirst, filter);
+                    std::vector<Plant*> paged;
+                    while (!cursor.isDone()) {
+                        std::vector<Plant*> page = cursor.next(7);
+                        paged.insert(paged.end(), page.begin(), page.end());
+                    }
+                    CHECK(paged == expected);
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    quietLogging();
+
+    RoseFactory roses;
+    CactusFactory cacti;
+    LavenderFactory lavender;
+    std::vector<Plant*> plants;
+    roses.createPlants(120, plants);
+    cacti.createPlants(120, plants);
+    lavender.createPlants(60, plants);
+
+    std::mt19937 rng(2024);
+    for (Plant* plant : plants) {
+        plant->setBasePrice(10.0 * static_cast<double>(rng() % 20));    // Many equal keys
+        plant->setHealthLevel(static_cast<int>(rng() % 101));
+        plant->setReadyForSale(rng() % 4 == 0);
+    }
+
+    GreenhouseInventory inventory;
+    std::vector<Plant*> held;
+    for (size_t i = 0; i < plants.size(); i += 2) {
+        inventory.addPlant(plants[i]);
+        held.push_back(plants[i]);
+    }
+    checkRankings(inventory, held);   // Orders built from existing contents
+
+    for (int round = 0; round < 6; round++) {
+        for (int change = 0; change < 60; change++) {
+            Plant* plant = plants[rng() % plants.size()];
+            switch (rng() % 6) {
+                case 0: plant->setBasePrice(10.0 * static_cast<double>(rng() % 20)); break;
+                case 1: plant->setHealthLevel(static_cast<int>(rng() % 101)); break;
+                case 2: plant->setReadyForSale(!plant->isReadyForSale()); break;
+                case 3: plant->setPlantId(PlantFactory::reservePlantIds(1)); break;
+                case 4: {
+                    auto it = std::find(held.begin(), held.end(), plant);
+                    if (it == held.end()) {
+                        inventory.addPlant(plant);
+                        held.push_back(plant);
+                    } else {
+                        inventory.removePlant(plant);
+                        held.erase(it);
+                    }
+                    break;
+                }
+                default: plant->setDaysToMaturity(static_cast<int>(rng() % 60)); break;
+            }
+        }
+        std::set<PlantStore*> stores;
+        for (Plant* plant : plants) {
+            stores.insert(plant->getStore());
+        }
+        for (PlantStore* store : stores) {
+            store->tickAll(static_cast<int>(rng() % 10));
+        }
+        checkRankings(inventory, held);
+    }
+
+    for (Plant* plant : plants) {
+        delete plant;
+    }
+    return testResult("InventoryRankingTest");
+}
@@ -0,0 +1,218 @@
+#include "TestSupport.h"
+#include "../Composite - The Store layout/ParallelGreenhouseVisitor.h"
+#include "../Composite - The Store layout/Greenhouse.h"
+#include "../Composite - The Store layout/GreenhouseSection.h"
+#include "../Composite - The Store layout/Shelf.h"
+#include "../Composite - The Store layout/PlantLeaf.h"
+#include "../Core - Simulation Services/WorkStealingPool.h"
+#include "../Factory - Plant Creation/RoseFactory.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Checks ParallelGreenhouseVisitor against a sequential pre-order walk:
+ * sum(), minPlant()/maxPlant() (first in layout order on ties) and collect()
+ * (same plants, same order), over pools of several sizes and a range of
+ * grains, with traversals forked from inside pool tasks, and with a visitor
+ * that throws.
+ */
+
+namespace {
+    void sequentialPlants(const GreenhouseComponent* node, std::vector<Plant*>& out) {
+        if (const PlantLeaf* leaf = dynamic_cast<const PlantLeaf*>(node)) {
+            if (leaf->getPlant()) {
+                out.push_back(leaf->getPlant());
+            }
+            return;
+        }
+        for (int i = 0; i < node->getChildCount(); i++) {
+            if (const GreenhouseComponent* child = node->getChild(i)) {
+                sequentialPlants(child, out);
+            }
+        }
+    }
+
+    std::vector<Plant*> sequentialPlants(const GreenhouseComponent* root) {
+        std::vector<Plant*> out;
+        sequentialPlants(root, out);
+        return out;
+    }
+
+    /**
+     * @brief Layout of uneven shape: many small shelves, one huge shelf, deep nesting and empty nodes
+     */
+    Greenhouse* buildLayout(const std::vector<Plant*>& plants) {
+        size_t next = 0;
+        int shelfNumber = 1;
+        Greenhouse* greenhouse = new Greenhouse("Test Greenhouse");
+
+        GreenhouseSection* small = new GreenhouseSection("flowering", "Small Shelves");
+        for (int s = 0; s < 40; s++) {
+            Shelf* shelf = new Shelf(shelfNumber++);
+            for (int p = 0; p < 12; p++) {
+                shelf->add(new PlantLeaf(plants[next++]));
+            }
+            small->add(shelf);
+        }
+        small->add(new Shelf(shelfNumber++));   // Empty shelf
+        greenhouse->add(small);
+
+        GreenhouseSection* big = new GreenhouseSection("tropical", "One Big Shelf");
+        Shelf* bigShelf = new Shelf(shelfNumber++);
+        for (int p = 0; p < 2500; p++) {
+            bigShelf->add(new PlantLeaf(plants[next++]));
+        }
+        bigShelf->add(new PlantLeaf(nullptr, "Empty Leaf"));
+        big->add(bigShelf);
+        greenhouse->add(big);
+
+        greenhouse->add(new GreenhouseSection("empty", "Empty Section"));
+
+        GreenhouseComponent* parent = greenhouse;
+        for (int depth = 0; depth < 6; depth++) {
+            GreenhouseSection* nested = new GreenhouseSection("nested", "Level " + std::to_string(depth));
+            Shelf* shelf = new Shelf(shelfNumber++);
+            for (int p = 0; p < 50; p++) {
+                shelf->add(new PlantLeaf(plants[next++]));
+            }
+            nested->add(shelf);
+            parent->add(nested);
+            parent = nested;
+        }
+
+        greenhouse->add(new PlantLeaf(plants[next++], "Loose Plant"));
+        return greenhouse;
+    }
+
+    double price(const Plant* plant) {
+        return plant->getBasePrice();
+    }
+
+    double health(const Plant* plant) {
+        return static_cast<double>(plant->getHealthLevel());
+    }
+
+    bool healthy(const Plant* plant) {
+        return plant->getHealthLevel() > 50;
+    }
+
+    void checkAgainstSequential(const ParallelGreenhouseVisitor& parallel, const Greenhouse* greenhouse,
+                                const std::vector<Plant*>& order) {
+        double expectedSum = 0.0;
+        Plant* expectedMin = nullptr;
+        Plant* expectedMax = nullptr;
+        std::vector<Plant*> expectedHealthy;
+        for (Plant* plant : order) {
+            expectedSum += price(plant);
+            if (!expectedMin || health(plant) < health(expectedMin)) {
+                expectedMin = plant;
+            }
+            if (!expectedMax || health(plant) > health(expectedMax)) {
+                expectedMax = plant;
+            }
+            if (healthy(plant)) {
+                expectedHealthy.push_back(plant);
+            }
+        }
+
+        CHECK(parallel.sum(greenhouse, price) == expectedSum);   // Whole prices: exact in any grouping
+        CHECK(parallel.minPlant(greenhouse, health) == expectedMin);
+        CHECK(parallel.maxPlant(greenhouse, health) == expectedMax);
+        CHECK(parallel.collect(greenhouse, healthy) == expectedHealthy);
+        CHECK(parallel.collect(greenhouse, [](const Plant*) { return true; }) == order);
+
+        // A subtree on its own, and an empty one
+        const GreenhouseComponent* big = greenhouse->getChild(1);
+        CHECK(parallel.collect(big, healthy) == parallel.collect(greenhouse, [big](const Plant* p) {
+            return healthy(p) && p->getLeaf() && p->getLeaf()->getParent()->getParent() == big;
+        }));
+        CHECK(parallel.sum(greenhouse->getChild(2), price) == 0.0);
+        CHECK(parallel.maxPlant(greenhouse->getChild(2), health) == nullptr);
+    }
+
+    /**
+     * @brief Traversals started from inside pool tasks, one per top-level child
+     */
+    void checkNestedFork(WorkStealingPool& pool, const ParallelGreenhouseVisitor& parallel,
+                         const Greenhouse* greenhouse) {
+        const int count = greenhouse->getChildCount();
+        std::vector<std::vector<Plant*>> parts(count);
+        WorkStealingPool::TaskGroup group;
+        for (int i = 0; i < count; i++) {
+            pool.spawn(group, [&parts, &parallel, greenhouse, i]() {
+                parts[i] = parallel.collect(greenhouse->getChild(i), healthy);
+            });
+        }
+        pool.wait(group);
+
+        std::vector<Plant*> joined;
+        for (const std::vector<Plant*>& part : parts) {
+            joined.insert(joined.end(), part.begin(), part.end());
+        }
+        CHECK(joined == parallel.collect(greenhouse, healthy));
+    }
+
+    void checkThrowingVisitor(const ParallelGreenhouseVisitor& parallel, const Greenhouse* greenhouse,
+                              const std::vector<Plant*>& order) {
+        for (size_t victim : {static_cast<size_t>(0), order.size() / 2, order.size() - 1}) {
+            const Plant* bad = order[victim];
+            bool thrown = false;
+            try {
+                parallel.forEachPlant(greenhouse, [bad](Plant* plant) {
+                    if (plant == bad) {
+                        throw std::runtime_error("bad plant");
+                    }
+                });
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+            CHECK(thrown);
+        }
+        // The pool is still usable afterwards
+        CHECK(parallel.collect(greenhouse, [](const Plant*) { return true; }) == order);
+    }
+}
+
+int main() {
+    quietLogging();
+
+    RoseFactory roses;
+    std::vector<Plant*> plants;
+    roses.createPlants(40 * 12 + 2500 + 6 * 50 + 1, plants);
+    std::mt19937 rng(7);
+    for (Plant* plant : plants) {
+        plant->setBasePrice(static_cast<double>(1 + rng() % 200));
+        plant->setHealthLevel(static_cast<int>(rng() % 101));   // Many ties for min/max
+    }
+
+    Greenhouse* greenhouse = buildLayout(plants);
+    const std::vector<Plant*> order = sequentialPlants(greenhouse);
+    CHECK(order.size() == plants.size());
+
+    for (size_t workers : {1, 2, 5}) {
+        std::unique_ptr<WorkStealingPool> pool(new WorkStealingPool(workers));
+        for (size_t grain : {1, 7, 64, 1000, 100000}) {
+            ParallelGreenhouseVisitor parallel(*pool, grain);
+            checkAgainstSequential(parallel, greenhouse, order);
+            checkNestedFork(*pool, parallel, greenhouse);
+        }
+        checkThrowingVisitor(ParallelGreenhouseVisitor(*pool, 16), greenhouse, order);
+    }
+    checkAgainstSequential(ParallelGreenhouseVisitor(), greenhouse, order);
+
+    // Values changed after a traversal are seen by the next one
+    plants[100]->setHealthLevel(100);
+    plants[2000]->setHealthLevel(0);
+    ParallelGreenhouseVisitor parallel(WorkStealingPool::shared(), 32);
+    checkAgainstSequential(parallel, greenhouse, order);
+
+    delete greenhouse;
+    for (Plant* plant : plants) {
+        delete plant;
+    }
+    return testResult("ParallelGreenhouseVisitorTest");
+}
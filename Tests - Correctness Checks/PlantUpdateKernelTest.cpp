@@ -0,0 +1,141 @@
+#include "TestSupport.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include "../Plant - Abstract Base/PlantUpdateKernel.h"
+#include "../Factory - Plant Creation/RoseFactory.h"
+#include "../Factory - Plant Creation/CactusFactory.h"
+#include <cstring>
+#include <random>
+#include <vector>
+
+/**
+ * Every kernel level must give bit-identical results to calling
+ * Plant::update() once per day on each plant, over randomised populations.
+ */
+
+namespace {
+    // Column copy of a population, in the layout PlantUpdateKernel::run() expects
+    struct Population {
+        std::vector<int> age, currentGrowthDays, healthLevel;
+        std::vector<double> height;
+        std::vector<unsigned char> readyForSale;
+        std::vector<int> daysToMaturity, wateringFrequency, fertilizingFrequency;
+        std::vector<int> timesWatered, timesFertilized;
+
+        explicit Population(const std::vector<Plant*>& plants) {
+            for (const Plant* plant : plants) {
+                age.push_back(plant->getAge());
+                currentGrowthDays.push_back(plant->getCurrentGrowthDays());
+                healthLevel.push_back(plant->getHealthLevel());
+                height.push_back(plant->getHeight());
+                readyForSale.push_back(plant->isReadyForSale() ? 1 : 0);
+                daysToMaturity.push_back(plant->getDaysToMaturity());
+                wateringFrequency.push_back(plant->getWateringFrequency());
+                fertilizingFrequency.push_back(plant->getFertilizingFrequency());
+                timesWatered.push_back(plant->getTimesWatered());
+                timesFertilized.push_back(plant->getTimesFertilized());
+            }
+        }
+
+        PlantUpdateKernel::Columns columns() {
+            PlantUpdateKernel::Columns cols;
+            cols.age = age.data();
+            cols.currentGrowthDays = currentGrowthDays.data();
+            cols.healthLevel = healthLevel.data();
+            cols.height = height.data();
+            cols.readyForSale = readyForSale.data();
+            cols.daysToMaturity = daysToMaturity.data();
+            cols.wateringFrequency = wateringFrequency.data();
+            cols.fertilizingFrequency = fertilizingFrequency.data();
+            cols.timesWatered = timesWatered.data();
+            cols.timesFertilized = timesFertilized.data();
+            return cols;
+        }
+    };
+
+    std::vector<Plant*> randomPopulation(std::mt19937& rng, size_t count) {
+        RoseFactory roses;
+        CactusFactory cacti;
+        std::vector<Plant*> plants;
+        for (size_t i = 0; i < count; i++) {
+            Plant* plant = (rng() % 2) ? roses.createPlant() : cacti.createPlant();
+            plant->setHealthLevel(static_cast<int>(rng() % 101));
+            plant->setWateringFrequency(1 + static_cast<int>(rng() % 20));
+            plant->setFertilizingFrequency(1 + static_cast<int>(rng() % 40));
+            plant->setDaysToMaturity(static_cast<int>(rng() % 100));
+            plant->setHeight(static_cast<double>(rng() % 1000) / 7.0 - 20.0);
+            if (rng() % 3 == 0) {
+                plant->setReadyForSale(true);
+            }
+            for (int k = static_cast<int>(rng() % 5); k > 0; k--) {
+                plant->water();
+            }
+            for (int k = static_cast<int>(rng() % 3); k > 0; k--) {
+                plant->fertilize();
+            }
+            for (int k = static_cast<int>(rng() % 10); k > 0; k--) {
+                plant->incrementAge();
+            }
+            plants.push_back(plant);
+        }
+        return plants;
+    }
+
+    void checkLevel(PlantUpdateKernel::Level level, unsigned seed) {
+        std::mt19937 rng(seed);
+        // Odd sizes leave a scalar tail after the 4- and 8-wide blocks
+        const size_t count = 1000 + seed * 37;
+        const int days = 1 + static_cast<int>(rng() % 90);
+        std::vector<Plant*> plants = randomPopulation(rng, count);
+
+        Population population(plants);
+        PlantUpdateKernel::forceLevel(level);
+        PlantUpdateKernel::run(population.columns(), count, days, nullptr);
+
+        for (int day = 0; day < days; day++) {
+            for (Plant* plant : plants) {
+                plant->update();
+            }
+        }
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < count; i++) {
+            const Plant* plant = plants[i];
+            const double height = plant->getHeight();
+            if (population.age[i] != plant->getAge() ||
+                population.currentGrowthDays[i] != plant->getCurrentGrowthDays() ||
+                population.healthLevel[i] != plant->getHealthLevel() ||
+                (population.readyForSale[i] != 0) != plant->isReadyForSale() ||
+                std::memcmp(&population.height[i], &height, sizeof(double)) != 0) {
+                mismatches++;
+            }
+        }
+        if (mismatches != 0) {
+            std::cerr << PlantUpdateKernel::levelName(level) << " seed " << seed << ": "
+                      << mismatches << " of " << count << " plants differ" << std::endl;
+        }
+        CHECK(mismatches == 0);
+
+        for (Plant* plant : plants) {
+            delete plant;
+        }
+    }
+}
+
+int main() {
+    quietLogging();
+    const PlantUpdateKernel::Level levels[] = {
+        PlantUpdateKernel::Level::Scalar,
+        PlantUpdateKernel::Level::SSE2,
+        PlantUpdateKernel::Level::AVX2
+    };
+    for (PlantUpdateKernel::Level level : levels) {
+        PlantUpdateKernel::forceLevel(level);
+        std::cout << "Checking " << PlantUpdateKernel::levelName(level) << " (runs as "
+                  << PlantUpdateKernel::levelName(PlantUpdateKernel::activeLevel()) << ")" << std::endl;
+        for (unsigned seed = 1; seed <= 8; seed++) {
+            checkLevel(level, seed);
+        }
+    }
+    PlantUpdateKernel::clearForcedLevel();
+    return testResult("PlantUpdateKernelTest");
+}
@@ -0,0 +1,198 @@
+#include "TestSupport.h"
+#include "../Iterator - Inventory Management/ShardedInventory.h"
+#include "../Iterator - Inventory Management/PlantIterator.h"
+#include "../Composite - The Store layout/Greenhouse.h"
+#include "../Composite - The Store layout/GreenhouseSection.h"
+#include "../Composite - The Store layout/Shelf.h"
+#include "../Composite - The Store layout/PlantLeaf.h"
+#include "../Factory - Plant Creation/CactusFactory.h"
+#include "../Factory - Plant Creation/RoseFactory.h"
+#include "../Plant - Abstract Base/Plant.h"
+#include <atomic>
+#include <map>
+#include <vector>
+
+/**
+ * Checks for ShardedInventory: section routing (including plants placed or
+ * moved after the inventory was built), add/remove, and that the merged and
+ * per-shard iterators visit every held plant exactly once.
+ */
+
+namespace {
+    /**
+     * @brief How many times an iterator yields each plant
+     */
+    std::map<Plant*, int> visits(PlantIterator* iterator) {
+        std::map<Plant*, int> seen;
+        for (iterator->first(); !iterator->isDone(); iterator->next()) {
+            seen[iterator->currentItem()]++;
+        }
+        delete iterator;
+        return seen;
+    }
+
+    /**
+     * @brief True if the inventory's iterators yield exactly the given plants, each once
+     */
+    bool iteratesExactly(ShardedInventory& inventory, const std::vector<Plant*>& expected) {
+        std::map<Plant*, int> seen = visits(inventory.createIterator());
+        if (seen.size() != expected.size()) {
+            return false;
+        }
+        for (Plant* plant : expected) {
+            auto it = seen.find(plant);
+            if (it == seen.end() || it->second != 1) {
+                return false;
+            }
+        }
+
+        // The per-shard iterators split the same plants by shard
+        size_t total = 0;
+        for (size_t shard = 0; shard < inventory.getShardCount(); shard++) {
+            std::map<Plant*, int> inShard = visits(inventory.createShardIterator(shard));
+            if (inShard.size() != inventory.getShardSize(shard)) {
+                return false;
+            }
+            for (const auto& entry : inShard) {
+                if (entry.second != 1 || inventory.shardOf(entry.first) != shard) {
+                    return false;
+                }
+            }
+            total += inShard.size();
+        }
+        return total == expected.size() && inventory.getCount() == expected.size();
+    }
+
+    void testSectionRouting() {
+        CactusFactory cacti;
+        RoseFactory roses;
+        std::vector<Plant*> desertPlants;
+        std::vector<Plant*> floweringPlants;
+        cacti.createPlants(3, desertPlants);
+        roses.createPlants(3, floweringPlants);
+
+        Greenhouse* greenhouse = new Greenhouse("Test Greenhouse");
+        GreenhouseSection* desert = new GreenhouseSection("desert", "Desert Section");
+        Shelf* shelf1 = new Shelf(1);
+        shelf1->add(new PlantLeaf(desertPlants[0], "Cactus A"));
+        shelf1->add(new PlantLeaf(desertPlants[1], "Cactus B"));
+        desert->add(shelf1);
+        greenhouse->add(desert);
+        GreenhouseSection* flowering = new GreenhouseSection("flowering", "Flowering Section");
+        Shelf* shelf2 = new Shelf(2);
+        shelf2->add(new PlantLeaf(floweringPlants[0], "Rose A"));
+        shelf2->add(new PlantLeaf(floweringPlants[1], "Rose B"));
+        flowering->add(shelf2);
+        greenhouse->add(flowering);
+        greenhouse->add(new PlantLeaf(desertPlants[2], "Loose Cactus"));   // Under no section
+
+        ShardedInventory inventory(greenhouse);
+        CHECK(inventory.getShardCount() == 3);
+        CHECK(inventory.getShardName(0) == "desert");
+        CHECK(inventory.getShardName(1) == "flowering");
+        CHECK(inventory.getShardName(2) == "unplaced");
+        CHECK(inventory.shardOf(desertPlants[0]) == 0);
+        CHECK(inventory.shardOf(desertPlants[1]) == 0);
+        CHECK(inventory.shardOf(floweringPlants[0]) == 1);
+        CHECK(inventory.shardOf(floweringPlants[1]) == 1);
+        CHECK(inventory.shardOf(desertPlants[2]) == 2);
+        CHECK(iteratesExactly(inventory, {desertPlants[0], desertPlants[1], floweringPlants[0],
+                                          floweringPlants[1], desertPlants[2]}));
+
+        // A plant placed after construction goes to its section's shard
+        shelf2->add(new PlantLeaf(floweringPlants[2], "Rose C"));
+        inventory.addPlant(floweringPlants[2]);
+        CHECK(inventory.shardOf(floweringPlants[2]) == 1);
+        CHECK(inventory.getShardSize(1) == 3);
+
+        // Plants outside every known section are not mixed into a section's shard
+        RoseFactory moreRoses;
+        std::vector<Plant*> outside;
+        moreRoses.createPlants(2, outside);
+        inventory.addPlant(outside[0]);                       // Not in the layout at all
+        GreenhouseSection* tropical = new GreenhouseSection("tropical", "Tropical Section");
+        Shelf* shelf3 = new Shelf(3);
+        shelf3->add(new PlantLeaf(outside[1], "Late Rose"));
+        tropical->add(shelf3);
+        greenhouse->add(tropical);                            // Section added after construction
+        inventory.addPlant(outside[1]);
+        CHECK(inventory.shardOf(outside[0]) == 2);
+        CHECK(inventory.shardOf(outside[1]) == 2);
+        CHECK(inventory.getShardSize(0) == 2);
+        CHECK(inventory.getShardSize(1) == 3);
+        CHECK(inventory.getShardSize(2) == 3);
+
+        // Adding a held plant again is ignored
+        inventory.addPlant(desertPlants[0]);
+        inventory.addPlant(floweringPlants[2]);
+        CHECK(inventory.getCount() == 8);
+
+        // A plant that changed section is still found, not duplicated, and removable
+        CHECK(greenhouse->relocatePlant(desertPlants[1], 2));
+        CHECK(inventory.contains(desertPlants[1]));
+        CHECK(inventory.shardOf(desertPlants[1]) == 0);       // Where it is held
+        inventory.addPlant(desertPlants[1]);
+        CHECK(inventory.getCount() == 8);
+        inventory.removePlant(desertPlants[1]);
+        CHECK(!inventory.contains(desertPlants[1]));
+        CHECK(inventory.getShardSize(0) == 1);
+        inventory.addPlant(desertPlants[1]);                  // Re-added under its new section
+        CHECK(inventory.shardOf(desertPlants[1]) == 1);
+
+        inventory.removePlant(floweringPlants[0]);
+        inventory.removePlant(outside[0]);
+        inventory.removePlant(outside[0]);                    // Already gone: no effect
+        CHECK(!inventory.contains(floweringPlants[0]));
+        CHECK(iteratesExactly(inventory, {desertPlants[0], desertPlants[1], floweringPlants[1],
+                                          floweringPlants[2], desertPlants[2], outside[1]}));
+
+        delete greenhouse;
+        for (std::vector<Plant*>* plants : {&desertPlants, &floweringPlants, &outside}) {
+            for (Plant* plant : *plants) {
+                delete plant;
+            }
+        }
+    }
+
+    void testHashRouting() {
+        RoseFactory roses;
+        std::vector<Plant*> plants;
+        roses.createPlants(200, plants);
+
+        ShardedInventory inventory(4);
+        CHECK(inventory.getShardCount() == 4);
+        for (Plant* plant : plants) {
+            inventory.addPlant(plant);
+            inventory.addPlant(plant);
+        }
+        CHECK(inventory.getCount() == plants.size());
+        CHECK(iteratesExactly(inventory, plants));
+
+        std::vector<Plant*> kept;
+        for (size_t i = 0; i < plants.size(); i++) {
+            if (i % 3 == 0) {
+                inventory.removePlant(plants[i]);
+            } else {
+                kept.push_back(plants[i]);
+            }
+        }
+        CHECK(iteratesExactly(inventory, kept));
+
+        std::atomic<size_t> visited(0);
+        inventory.forEachShardParallel([&visited](size_t, const std::vector<Plant*>& shard) {
+            visited += shard.size();
+        });
+        CHECK(visited.load() == kept.size());
+
+        for (Plant* plant : plants) {
+            delete plant;
+        }
+    }
+}
+
+int main() {
+    quietLogging();
+    testSectionRouting();
+    testHashRouting();
+    return testResult("ShardedInventoryTest");
+}
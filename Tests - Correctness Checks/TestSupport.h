@@ -0,0 +1,49 @@
+#ifndef TESTSUPPORT_H
+#define TESTSUPPORT_H
+
+#include "../Core - Simulation Services/Logger.h"
+#include <iostream>
+
+/**
+ * @brief Minimal check helpers shared by the ctest executables
+ *
+ * A failed CHECK prints its location and keeps going, so one run reports
+ * every mismatch; testResult() turns the tally into the process exit code.
+ */
+
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition)                                                              \
+    do {                                                                              \
+        if (!(condition)) {                                                           \
+            testFailures()++;                                                         \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: " #condition \
+                      << std::endl;                                                   \
+        }                                                                             \
+    } while (0)
+
+/**
+ * @brief Keep the simulation's own log output out of the test log
+ */
+inline void quietLogging() {
+    Logger::getInstance().setLevel(LogLevel::Warn);
+}
+
+/**
+ * @brief Report the outcome of a test executable
+ * @return Exit code for main() (0 when every check passed)
+ */
+inline int testResult(const char* name) {
+    Logger::getInstance().flush();
+    if (testFailures() == 0) {
+        std::cout << name << ": all checks passed" << std::endl;
+        return 0;
+    }
+    std::cout << name << ": " << testFailures() << " check(s) failed" << std::endl;
+    return 1;
+}
+
+#endif // TESTSUPPORT_H
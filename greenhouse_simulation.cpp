@@ -48,6 +48,7 @@
 // Iterator Pattern
 #include "Iterator - Inventory Management/PlantIterator.h"
 #include "Iterator - Inventory Management/GreenhouseInventory.h"
+#include "Iterator - Inventory Management/PlantViews.h"
 
 // Template Pattern
 #include "Template- Plant Care/PlantCareRoutine.h"
@@ -150,9 +151,8 @@ vector<Plant*> demonstrateFactoryPattern() {
 
     for (PlantFactory* factory : factories) {
         cout << "\nUsing " << factory->getPlantType() << " Factory" << endl;
-        Plant* plant = factory->createPlant();
-        plant->setPlantId(plants.size() + 1);
-        plants.push_back(plant);
+        factory->createPlants(1, plants);
+        Plant* plant = plants.back();
 
         cout << "  Created: " << plant->getSpecies() << endl;
         cout << "  Price: R" << fixed << setprecision(2) << plant->getBasePrice() << endl;
@@ -191,7 +191,7 @@ void demonstratePrototypePattern(vector<Plant*>& plants) {
 
     // Clone the rose
     Plant* clonedRose = originalRose->clone();
-    clonedRose->setPlantId(plants.size() + 1);
+    clonedRose->setPlantId(PlantFactory::reservePlantIds(1));
     plants.push_back(clonedRose);
 
     cout << "\nCloned Rose (Propagated):" << endl;
@@ -205,7 +205,7 @@ void demonstratePrototypePattern(vector<Plant*>& plants) {
 
     Plant* originalSucculent = plants[3];
     Plant* clonedSucculent = originalSucculent->clone();
-    clonedSucculent->setPlantId(plants.size() + 1);
+    clonedSucculent->setPlantId(PlantFactory::reservePlantIds(1));
     plants.push_back(clonedSucculent);
 
     cout << "\nCloned Succulent (Propagated):" << endl;
@@ -226,7 +226,7 @@ void demonstratePrototypePattern(vector<Plant*>& plants) {
     cout << "\nCreating multiple clones for nursery stock:" << endl;
     for (int i = 0; i < 3; i++) {
         Plant* clone = originalRose->clone();
-        clone->setPlantId(plants.size() + 1);
+        clone->setPlantId(PlantFactory::reservePlantIds(1));
         plants.push_back(clone);
         cout << "  Clone #" << (i + 1) << " created (ID: " << clone->getPlantId() << ")" << endl;
     }
@@ -283,6 +283,13 @@ Greenhouse* demonstrateCompositePattern(vector<Plant*>& plants) {
     printSubheader("Displaying Greenhouse Hierarchy");
     greenhouse->display(0);
 
+    printSubheader("Locating Plants");
+    cout << "\n" << plants[2]->getSpecies() << " #" << plants[2]->getPlantId()
+         << " is at: " << plants[2]->getLocation() << endl;
+    if (Shelf* found = greenhouse->findShelf(3)) {
+        cout << "Shelf #3 is at: " << greenhouse->pathOf(found) << endl;
+    }
+
     cout << "\nBENEFIT: Composite pattern allows treating individual plants and" << endl;
     cout << "groups of plants uniformly, simplifying greenhouse management." << endl;
 
@@ -322,6 +329,25 @@ GreenhouseInventory* demonstrateIteratorPattern(vector<Plant*>& plants) {
         cout << "    Health: " << plant->getHealthLevel() << "%" << endl;
     }
 
+    printSubheader("Lazy Views over the Inventory");
+
+    cout << "\nHealthy plants priced under R50 (filtered on the fly, nothing copied):" << endl;
+    for (Plant* plant : *inventory | PlantViews::healthBetween(80) | PlantViews::priceBetween(0.0, 50.0)) {
+        cout << "  - " << plant->getSpecies() << " (ID: " << plant->getPlantId() << ")" << endl;
+    }
+
+    double stockValue = 0.0;
+    for (double price : *inventory | PlantViews::prices()) {
+        stockValue += price;
+    }
+    cout << "Total stock value: R" << fixed << setprecision(2) << stockValue << endl;
+
+    cout << "\nThree most valuable plants (ranked index, no sort):" << endl;
+    for (Plant* plant : inventory->topK(PlantRank::Price, 3, true)) {
+        cout << "  - " << plant->getSpecies() << " (ID: " << plant->getPlantId()
+             << ") R" << plant->getBasePrice() << endl;
+    }
+
     cout << "\nBENEFIT: Iterator provides a standard way to traverse collections," << endl;
     cout << "hiding the internal storage structure from clients." << endl;
 
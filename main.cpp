@@ -19,6 +19,8 @@ using namespace std;
 
 // Plant base class
 #include "Plant - Abstract Base/Plant.h"
+#include "Plant - Abstract Base/PlantStore.h"
+#include "Plant - Abstract Base/AttentionBitmaps.h"
 
 // Factory Pattern
 #include "Factory - Plant Creation/PlantFactory.h"
@@ -27,6 +29,7 @@ using namespace std;
 #include "Factory - Plant Creation/SucculentFactory.h"
 #include "Factory - Plant Creation/LavenderFactory.h"
 #include "Factory - Plant Creation/BaobabFactory.h"
+#include "Factory - Plant Creation/PlantPool.h"
 
 // Composite Pattern
 #include "Composite - The Store layout/GreenhouseComponent.h"
@@ -34,6 +37,7 @@ using namespace std;
 #include "Composite - The Store layout/GreenhouseSection.h"
 #include "Composite - The Store layout/Shelf.h"
 #include "Composite - The Store layout/PlantLeaf.h"
+#include "Composite - The Store layout/ParallelGreenhouseVisitor.h"
 
 // Iterator Pattern
 #include "Iterator - Inventory Management/PlantIterator.h"
@@ -149,8 +153,10 @@ struct GreenhouseState {
     ~GreenhouseState() {
         delete greenhouse;
         delete inventory;
-        for (auto plant : allPlants) delete plant;
         for (auto product : customerCart) delete product;
+        // Every plant comes from a species pool - release them all at once
+        PlantPool::releaseAllPools();
+        allPlants.clear();
     }
 };
 
@@ -158,6 +164,16 @@ GreenhouseState* state = nullptr;
 
 // ==================== INITIALIZATION ====================
 
+// Create a batch of sale-ready plants and place them on a shelf
+void seedShelf(PlantFactory& factory, size_t count, Shelf* shelf) {
+    size_t first = state->allPlants.size();
+    factory.createPlants(count, state->allPlants);
+    for (size_t i = first; i < state->allPlants.size(); i++) {
+        state->allPlants[i]->setReadyForSale(true);
+        shelf->add(new PlantLeaf(state->allPlants[i]));
+    }
+}
+
 void initializeGreenhouse() {
     printHeader("GREENHOUSE SYSTEM INITIALIZATION");
     cout << "\nSetting up greenhouse structure and initial inventory..." << endl;
@@ -182,44 +198,12 @@ void initializeGreenhouse() {
     LavenderFactory lavenderFactory;
     BaobabFactory baobabFactory;
 
-    // Create plants
-    for (int i = 1; i <= 3; i++) {
-        Plant* rose = roseFactory.createPlant();
-        rose->setPlantId(state->allPlants.size() + 1);
-        rose->setReadyForSale(true);
-        state->allPlants.push_back(rose);
-        tropicalShelf1->add(new PlantLeaf(rose));
-    }
-
-    for (int i = 1; i <= 4; i++) {
-        Plant* cactus = cactusFactory.createPlant();
-        cactus->setPlantId(state->allPlants.size() + 1);
-        cactus->setReadyForSale(true);
-        state->allPlants.push_back(cactus);
-        desertShelf1->add(new PlantLeaf(cactus));
-    }
-
-    for (int i = 1; i <= 3; i++) {
-        Plant* succulent = succulentFactory.createPlant();
-        succulent->setPlantId(state->allPlants.size() + 1);
-        succulent->setReadyForSale(true);
-        state->allPlants.push_back(succulent);
-        desertShelf2->add(new PlantLeaf(succulent));
-    }
-
-    for (int i = 1; i <= 2; i++) {
-        Plant* lavender = lavenderFactory.createPlant();
-        lavender->setPlantId(state->allPlants.size() + 1);
-        lavender->setReadyForSale(true);
-        state->allPlants.push_back(lavender);
-        herbShelf1->add(new PlantLeaf(lavender));
-    }
-
-    Plant* baobab = baobabFactory.createPlant();
-    baobab->setPlantId(state->allPlants.size() + 1);
-    baobab->setReadyForSale(true);
-    state->allPlants.push_back(baobab);
-    tropicalShelf2->add(new PlantLeaf(baobab));
+    // Create plants (one batch per species)
+    seedShelf(roseFactory, 3, tropicalShelf1);
+    seedShelf(cactusFactory, 4, desertShelf1);
+    seedShelf(succulentFactory, 3, desertShelf2);
+    seedShelf(lavenderFactory, 2, herbShelf1);
+    seedShelf(baobabFactory, 1, tropicalShelf2);
 
     // Build structure
     tropicalSection->add(tropicalShelf1);
@@ -234,6 +218,7 @@ void initializeGreenhouse() {
 
     // Create inventory using Iterator Pattern
     state->inventory = new GreenhouseInventory();
+    state->inventory->reserve(state->allPlants.size());
     for (auto plant : state->allPlants) {
         state->inventory->addPlant(plant);
     }
@@ -250,6 +235,27 @@ void staffViewStoreLayout() {
     printHeader("GREENHOUSE STORE LAYOUT");
     cout << "\nComposite Pattern: Hierarchical greenhouse structure\n" << endl;
     state->greenhouse->display();
+
+    // Cached on every node - no walk over the leaves
+    for (int i = 0; i < state->greenhouse->getChildCount(); i++) {
+        GreenhouseComponent* section = state->greenhouse->getChild(i);
+        const SubtreeAggregates& totals = section->getAggregates();
+        cout << "  " << left << setw(20) << section->getName() << totals.plantCount << " plants, "
+             << totals.readyCount << " ready, R" << fixed << setprecision(2) << totals.totalValue;
+        if (totals.plantCount > 0) {
+            cout << ", lowest health " << totals.minHealth << "%";
+        }
+        cout << endl;
+    }
+
+    ParallelGreenhouseVisitor parallel;
+    vector<Plant*> thirsty = parallel.collect(state->greenhouse,
+                                              [](const Plant* plant) { return plant->needsWater(); });
+    cout << "\n  Plants due for watering: " << thirsty.size();
+    if (!thirsty.empty()) {
+        cout << " (first: " << thirsty.front()->getSpecies() << " at " << thirsty.front()->getLocation() << ")";
+    }
+    cout << endl;
     waitForUser();
 }
 
@@ -259,7 +265,6 @@ void staffViewInventory() {
     cout << "\nIterator Pattern: Traversing plant collection\n" << endl;
 
     PlantIterator* iterator = state->inventory->createIterator();
-    int count = 0;
 
     cout << left << setw(5) << "ID" << setw(15) << "Species"
          << setw(12) << "Price (R)" << setw(12) << "Health"
@@ -269,7 +274,6 @@ void staffViewInventory() {
     iterator->first();
     while (!iterator->isDone()) {
         Plant* plant = iterator->currentItem();
-        count++;
         cout << left << setw(5) << plant->getPlantId()
              << setw(15) << plant->getSpecies()
              << "R" << setw(11) << fixed << setprecision(2) << plant->getBasePrice()
@@ -279,7 +283,28 @@ void staffViewInventory() {
         iterator->next();
     }
 
-    cout << "\nTotal plants: " << count << endl;
+    // Summary comes from the inventory's running totals
+    InventoryTotals totals = state->inventory->getTotals();
+    cout << "\nTotal plants: " << totals.count
+         << " (" << state->inventory->getReadinessTotals(true).count << " ready for sale)" << endl;
+    cout << "Stock value: R" << fixed << setprecision(2) << totals.stockValue
+         << ", average health: " << setprecision(1) << totals.averageHealth() << "%" << endl;
+    for (const string& species : state->inventory->getSpeciesNames()) {
+        InventoryTotals group = state->inventory->getSpeciesTotals(species);
+        if (group.count > 0) {
+            cout << "  " << left << setw(12) << species << group.count << " plants, R"
+                 << setprecision(2) << group.stockValue << endl;
+        }
+    }
+
+    // Care needs for the whole store, evaluated column-wise in one pass
+    AttentionBitmaps attention;
+    PlantStore::getInstance().evaluateAttention(attention);
+    cout << "\nNeeding attention: " << attention.countAny()
+         << " (water " << attention.count(AttentionReason::Water)
+         << ", fertilizer " << attention.count(AttentionReason::Fertilizer)
+         << ", pruning " << attention.count(AttentionReason::Pruning)
+         << ", unhealthy " << attention.count(AttentionReason::Unhealthy) << ")" << endl;
     delete iterator;
     waitForUser();
 }
@@ -296,13 +321,7 @@ void staffPropagatePlant() {
     cin >> id;
     cin.ignore(numeric_limits<streamsize>::max(), '\n');
 
-    Plant* original = nullptr;
-    for (auto plant : state->allPlants) {
-        if (plant->getPlantId() == id) {
-            original = plant;
-            break;
-        }
-    }
+    Plant* original = state->inventory->findById(id);
 
     if (!original) {
         cout << "\nPlant not found!" << endl;
@@ -312,7 +331,7 @@ void staffPropagatePlant() {
 
     // Clone using Prototype Pattern
     Plant* clone = original->clone();
-    clone->setPlantId(state->allPlants.size() + 1);
+    clone->setPlantId(PlantFactory::reservePlantIds(1));
     clone->setReadyForSale(false); // New clones need time to mature
     clone->setHealthLevel(80); // Start with good health
 
@@ -545,14 +564,14 @@ void customerBrowsePlants() {
          << setw(12) << "Price (R)" << setw(12) << "Health" << endl;
     cout << string(50, '-') << endl;
 
-    for (auto plant : state->allPlants) {
-        if (plant->isReadyForSale()) {
-            cout << left << setw(5) << plant->getPlantId()
-                 << setw(15) << plant->getSpecies()
-                 << "R" << setw(11) << fixed << setprecision(2) << plant->getBasePrice()
-                 << setw(12) << plant->getHealthLevel() << "%"
-                 << endl;
-        }
+    InventoryQuery forSale;
+    forSale.readyOnly = true;
+    for (auto plant : state->inventory->query(forSale)) {
+        cout << left << setw(5) << plant->getPlantId()
+             << setw(15) << plant->getSpecies()
+             << "R" << setw(11) << fixed << setprecision(2) << plant->getBasePrice()
+             << setw(12) << plant->getHealthLevel() << "%"
+             << endl;
     }
 
     cout << "\nYour balance: R" << fixed << setprecision(2) << state->customerBalance << endl;
@@ -572,15 +591,9 @@ void customerBuyPlant() {
 
     if (id == 0) return;
 
-    Plant* plant = nullptr;
-    for (auto p : state->allPlants) {
-        if (p->getPlantId() == id && p->isReadyForSale()) {
-            plant = p;
-            break;
-        }
-    }
+    Plant* plant = state->inventory->findById(id);
 
-    if (!plant) {
+    if (!plant || !plant->isReadyForSale()) {
         cout << "\nPlant not found or not available for sale!" << endl;
         waitForUser();
         return;